@@ -0,0 +1,150 @@
+/* Ahead-of-time loop scanner:
+ * aotScan.c
+ *
+ * Standalone DynamoRIO program the parent runs in --aot mode. It decodes
+ * the executable sections of an ELF binary and finds loops with the same
+ * back-edge test detectLoop.c uses: a direct branch whose target lies
+ * between the start of its block and the branch itself. When the loop runs,
+ * DR builds a block starting at that target, ending at the branch, and the
+ * block goes into a trace. Each such block is written to stdout as a hint
+ * (see instrMessage.h), encoded exactly as the client would send it, so the
+ * parent can optimize it and cache the result before the program first runs.
+ *
+ * Usage: aotScan <elf> [load base]
+ * Position-independent binaries are assumed to be loaded at the load base,
+ * 0x555555554000 by default, which is where Linux puts them without ASLR.
+ */
+
+#include "dr_api.h"
+#include "instrMessage.h"
+
+#include<stdio.h>
+#include<stdlib.h>
+#include<string.h>
+#include<unistd.h>
+#include<elf.h>
+
+#define DEFAULT_PIE_BASE 0x555555554000ULL
+
+static unsigned char*
+read_file(const char* path, size_t* size)
+{
+	FILE* f = fopen(path, "rb");
+	if (f == NULL) return NULL;
+	fseek(f, 0, SEEK_END);
+	*size = ftell(f);
+	fseek(f, 0, SEEK_SET);
+	unsigned char* data = malloc(*size);
+	if (fread(data, 1, *size, f) != *size) {
+		free(data);
+		data = NULL;
+	}
+	fclose(f);
+	return data;
+}
+
+/* Decodes [start, end] (end is the back-edge branch) and writes it as a hint.
+ * Returns whether a hint was written.
+ */
+static int
+emit_loop(void* dc, unsigned char* copy, app_pc base, app_pc start, app_pc end, unsigned char* buf)
+{
+	instrlist_t* bb = instrlist_create(dc);
+	app_pc pc = start;
+	app_pc last = NULL;
+	while (pc <= end) {
+		instr_t* instr = instr_create(dc);
+		app_pc next = decode_from_copy(dc, copy + (pc - base), pc, instr);
+		if (next == NULL) {
+			instr_destroy(dc, instr);
+			instrlist_clear_and_destroy(dc, bb);
+			return 0;
+		}
+		next = pc + (next - (copy + (pc - base)));
+		instr_set_translation(instr, pc);
+		instrlist_append(bb, instr);
+		last = pc;
+		pc = next;
+	}
+	if (last != end) {
+		/* The target is not on an instruction boundary of this stream */
+		instrlist_clear_and_destroy(dc, bb);
+		return 0;
+	}
+	int len = encode_block_hint(dc, bb, QOS_DEFAULT, buf);
+	instrlist_clear_and_destroy(dc, bb);
+	if (len == 0) return 0;
+	if (write(STDOUT_FILENO, buf, len) != len) return 0;
+	return 1;
+}
+
+/* Sweeps one executable section, splitting blocks after every cti */
+static int
+scan_section(void* dc, unsigned char* copy, app_pc base, size_t size, unsigned char* buf)
+{
+	int loops = 0;
+	app_pc blockStart = base;
+	app_pc pc = base;
+	instr_t instr;
+	instr_init(dc, &instr);
+	while (pc < base + size) {
+		instr_reset(dc, &instr);
+		unsigned char* next = decode_from_copy(dc, copy + (pc - base), pc, &instr);
+		if (next == NULL || !instr_valid(&instr)) {
+			/* Data or padding; resynchronize on the next byte */
+			pc++;
+			blockStart = pc;
+			continue;
+		}
+		app_pc nextPc = pc + (next - (copy + (pc - base)));
+		if (instr_is_cti(&instr)) {
+			if ((instr_is_cbr(&instr) || instr_is_ubr(&instr)) && opnd_is_pc(instr_get_target(&instr))) {
+				app_pc target = opnd_get_pc(instr_get_target(&instr));
+				if (blockStart <= target && target < pc) {
+					loops += emit_loop(dc, copy, base, target, pc, buf);
+				}
+			}
+			blockStart = nextPc;
+		}
+		pc = nextPc;
+	}
+	instr_free(dc, &instr);
+	return loops;
+}
+
+int
+main(int argc, char** argv)
+{
+	if (argc < 2) {
+		fprintf(stderr, "Usage: aotScan <elf> [load base]\n");
+		return 1;
+	}
+	size_t size;
+	unsigned char* data = read_file(argv[1], &size);
+	Elf64_Ehdr* ehdr = (Elf64_Ehdr*) data;
+	if (data == NULL || size < sizeof(Elf64_Ehdr) || memcmp(ehdr->e_ident, ELFMAG, SELFMAG) != 0
+			|| ehdr->e_ident[EI_CLASS] != ELFCLASS64 || ehdr->e_machine != EM_X86_64
+			|| ehdr->e_shoff + (size_t) ehdr->e_shnum * sizeof(Elf64_Shdr) > size) {
+		fprintf(stderr, "aotScan: %s is not a 64-bit x86 ELF file\n", argv[1]);
+		return 1;
+	}
+	uint64_t loadBase = 0;
+	if (ehdr->e_type == ET_DYN) {
+		loadBase = argc > 2 ? strtoull(argv[2], NULL, 0) : DEFAULT_PIE_BASE;
+	}
+	void* dc = dr_standalone_init();
+	unsigned char* buf = malloc(HINT_MAX_SIZE);
+	Elf64_Shdr* shdrs = (Elf64_Shdr*) (data + ehdr->e_shoff);
+	int loops = 0;
+	for (int i = 0; i < ehdr->e_shnum; i++) {
+		Elf64_Shdr* sh = &shdrs[i];
+		if (sh->sh_type != SHT_PROGBITS || !(sh->sh_flags & SHF_EXECINSTR)) continue;
+		if (sh->sh_offset + sh->sh_size > size) continue;
+		loops += scan_section(dc, data + sh->sh_offset, (app_pc) (loadBase + sh->sh_addr), sh->sh_size, buf);
+	}
+	fprintf(stderr, "aotScan: found %d loop blocks in %s\n", loops, argv[1]);
+	free(buf);
+	free(data);
+	dr_standalone_exit();
+	return 0;
+}
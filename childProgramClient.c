@@ -40,9 +40,17 @@
 #include "dr_api.h"
 #include "drmgr.h"
 #include "drreg.h"
+#include "drx.h"
+#include "hashtable.h"
+#include "instrMessage.h"
 
 #include<unistd.h>
+#include<errno.h>
 #include<stdlib.h>
+#include<string.h>
+#include<fcntl.h>
+#include<sys/socket.h>
+#include<sys/un.h>
 
 #ifdef WINDOWS
 #    define DISPLAY_STRING(msg) dr_messagebox(msg)
@@ -57,9 +65,41 @@ static bool enable;
 /* Use atomic operations to increment these to avoid the hassle of locking. */
 static int num_examined, num_converted;
 
-/* Pipes */
+/* Pipes, or both ends of the connection to an optimizer daemon */
 static int readPipe, writePipe;
-//static sem_t pipeLock;
+/* Blocks are exchanged in lockstep, so only one thread may talk at a time */
+static void *pipeLock;
+
+/* QoS class of this process, set with -qos batch|default|latency */
+static int qos_class;
+
+/* Whether trace requests start with a summary, so that only instructions
+ * the parent asks for are described in full; -full turns it off
+ */
+static bool send_summary;
+
+/* How often each block ran before it became part of a trace, keyed by tag.
+ * Sent with the trace as a hint of how hot it is.
+ */
+static hashtable_t exec_counts;
+
+/* How often each conditional branch was taken and not taken while its block
+ * ran untraced, keyed by the branch's pc. Sent with the trace so the parent
+ * knows which branches are poorly predicted. For an indirect jmp or call,
+ * taken counts every execution and the first INDIRECT_TARGET_SLOTS targets
+ * it went to are counted separately, so the parent can check for the
+ * dominant one inline.
+ */
+#define INDIRECT_TARGET_SLOTS 4
+
+typedef struct {
+    uint64_t taken;
+    uint64_t notTaken;
+    app_pc targets[INDIRECT_TARGET_SLOTS];
+    uint64_t targetCounts[INDIRECT_TARGET_SLOTS];
+} branch_counts_t;
+
+static hashtable_t branch_counts;
 
 static dr_emit_flags_t
 event_instruction_change(void *drcontext, void *tag, instrlist_t *bb, bool for_trace,
@@ -68,14 +108,90 @@ event_instruction_change(void *drcontext, void *tag, instrlist_t *bb, bool for_t
 static void
 event_exit(void);
 
+static dr_emit_flags_t
+event_bb_insert(void *drcontext, void *tag, instrlist_t *bb, instr_t *instr,
+                bool for_trace, bool translating, void *user_data);
+
+static bool
+event_restore_state(void *drcontext, bool restore_memory, dr_restore_state_info_t *info);
+
+static void
+free_exec_counter(void *counter)
+{
+    dr_global_free(counter, sizeof(uint64_t));
+}
+
+static void
+free_branch_counts(void *counts)
+{
+    dr_global_free(counts, sizeof(branch_counts_t));
+}
+
+static branch_counts_t *
+get_branch_counts(app_pc pc, bool create)
+{
+    hashtable_lock(&branch_counts);
+    branch_counts_t *counts = hashtable_lookup(&branch_counts, pc);
+    if (counts == NULL && create) {
+        counts = dr_global_alloc(sizeof(branch_counts_t));
+        memset(counts, 0, sizeof(branch_counts_t));
+        hashtable_add(&branch_counts, pc, counts);
+    }
+    hashtable_unlock(&branch_counts);
+    return counts;
+}
+
+static uint64_t *
+get_exec_counter(void *tag, bool create)
+{
+    hashtable_lock(&exec_counts);
+    uint64_t *counter = hashtable_lookup(&exec_counts, tag);
+    if (counter == NULL && create) {
+        counter = dr_global_alloc(sizeof(uint64_t));
+        *counter = 0;
+        hashtable_add(&exec_counts, tag, counter);
+    }
+    hashtable_unlock(&exec_counts);
+    return counter;
+}
+
+static int
+parse_qos(const char *name)
+{
+    if (strcmp(name, "batch") == 0)
+        return QOS_BATCH;
+    if (strcmp(name, "latency") == 0)
+        return QOS_LATENCY;
+    return QOS_DEFAULT;
+}
+
+static int
+connect_to_daemon(const char *path)
+{
+    struct sockaddr_un addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    if (strlen(path) >= sizeof(addr.sun_path))
+        return -1;
+    strcpy(addr.sun_path, path);
+    int fd = socket(AF_UNIX, SOCK_SEQPACKET, 0);
+    if (fd == -1)
+        return -1;
+    if (connect(fd, (struct sockaddr *)&addr, sizeof(addr)) == -1) {
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
 DR_EXPORT void
 dr_client_main(client_id_t id, int argc, const char *argv[])
 {
-    /* We only used drreg for liveness, not for spilling, so we need no slots. */
-    drreg_options_t ops = { sizeof(ops), 0 /*no slots needed*/, false };
+    /* drx needs a register and the flags for the execution counters. */
+    drreg_options_t ops = { sizeof(ops), 2 /*max slots needed*/, false };
     dr_set_client_name("ChildProgram remote optimizer",
                        "http://dynamorio.org/issues");
-    if (!drmgr_init() || drreg_init(&ops) != DRREG_SUCCESS)
+    if (!drmgr_init() || drreg_init(&ops) != DRREG_SUCCESS || !drx_init())
         DR_ASSERT(false);
 
     /* Register for our events: process exit, and code transformation.
@@ -83,14 +199,20 @@ dr_client_main(client_id_t id, int argc, const char *argv[])
      * instrumentation.
      */
     dr_register_exit_event(event_exit);
-    if (!drmgr_register_bb_app2app_event(event_instruction_change, NULL))
+    if (!drmgr_register_bb_app2app_event(event_instruction_change, NULL) ||
+        !drmgr_register_bb_instrumentation_event(NULL, event_bb_insert, NULL) ||
+        !drmgr_register_restore_state_ex_event(event_restore_state))
         DR_ASSERT(false);
+    hashtable_init_ex(&exec_counts, 12, HASH_INTPTR, false /*!strdup*/, true /*synch*/,
+                      free_exec_counter, NULL, NULL);
+    hashtable_init_ex(&branch_counts, 12, HASH_INTPTR, false /*!strdup*/, true /*synch*/,
+                      free_branch_counts, NULL, NULL);
 
     /* Long ago, this optimization would target the Pentium 4 (identified via
      * "proc_get_family() == FAMILY_PENTIUM_4"), where an add of 1 is faster
      * than an inc.  For illustration purposes we leave a boolean controlling it
-     * but we turn it on all the time in this sample and leave it for future
-     * work to determine whether to disable it on certain microarchitectures.
+     * but we turn it on all the time: the parent now detects the CPU and its
+     * isel pass picks inc/dec or add/sub for it.
      */
     enable = true;
 
@@ -109,9 +231,33 @@ dr_client_main(client_id_t id, int argc, const char *argv[])
     /* Initialize our global variables. */
     num_examined = 0;
     num_converted = 0;
-    //sem_init(&pipeLock, 0, 1);
-    readPipe = atoi(argv[1]);
-    writePipe = atoi(argv[2]);
+    pipeLock = dr_mutex_create();
+    qos_class = QOS_DEFAULT;
+    send_summary = true;
+    const char *socketPath = NULL;
+    int numFds = 0;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-socket") == 0 && i + 1 < argc) {
+            socketPath = argv[++i];
+        } else if (strcmp(argv[i], "-qos") == 0 && i + 1 < argc) {
+            qos_class = parse_qos(argv[++i]);
+        } else if (strcmp(argv[i], "-full") == 0) {
+            send_summary = false;
+        } else if (numFds++ == 0) {
+            readPipe = atoi(argv[i]);
+        } else {
+            writePipe = atoi(argv[i]);
+        }
+    }
+    if (socketPath != NULL) {
+        /* Attach to a running optimizer daemon instead of an inherited pipe pair */
+        readPipe = writePipe = connect_to_daemon(socketPath);
+        if (readPipe == -1) {
+            dr_fprintf(STDERR, "childProgram: could not connect to %s, not optimizing\n",
+                       socketPath);
+            enable = false;
+        }
+    }
 }
 
 static void
@@ -133,65 +279,90 @@ event_exit(void)
     DISPLAY_STRING(msg);
 #endif /* SHOW_RESULTS */
     if (!drmgr_unregister_bb_app2app_event(event_instruction_change) ||
+        !drmgr_unregister_bb_instrumentation_event(NULL) ||
+        !drmgr_unregister_restore_state_ex_event(event_restore_state) ||
         drreg_exit() != DRREG_SUCCESS)
         DR_ASSERT(false);
+    hashtable_delete(&exec_counts);
+    hashtable_delete(&branch_counts);
+    drx_exit();
     drmgr_exit();
+    dr_mutex_destroy(pipeLock);
+    if (readPipe == -1)
+        return;
     int buf = -1;
     int err = write(writePipe, &buf, sizeof(int));
     err = read(readPipe, &buf, sizeof(int));
     close(readPipe);
-    close(writePipe);
+    if (writePipe != readPipe)
+        close(writePipe);
 }
 
-typedef struct {
-	int type;
-	int64_t longParam;
-	int p1;
-	int p2;
-} instr_opnd_t;
-
-void parse_opnd(instr_opnd_t* dest, opnd_t src) {
-	if (opnd_is_null(src)) {
-		dest->type = 0;
-	} else if (opnd_is_reg(src)) {
-		dest->type = 1;
-		dest->p1 = opnd_get_reg(src);
-	} else if (opnd_is_reg_partial(src)) {
-		dest->type = 2;
-	} else if (opnd_is_immed_int(src)) {
-		dest->type = 4;
-		dest->p1 = opnd_get_immed_int(src);
-	} else if (opnd_is_immed_int64(src)) {
-		dest->type = 5;
-		dest->longParam = opnd_get_immed_int64(src);
-	} else if (opnd_is_immed_float(src)) {
-		dest->type = 6;
-	} else if (opnd_is_near_pc(src)) {
-		dest->type = 7;
-		dest->longParam = (int64_t) opnd_get_pc(src);
-	} else if (opnd_is_far_pc(src)) {
-		dest->type = 8;
-	} else if (opnd_is_abs_addr(src)) {
-		dest->type = 9;
-	} else {
-		dest->type = -1;
-	}
-}
 
-typedef struct {
-	unsigned char* app_pc;
-	 int opcode;
-	 int numSrc;
-	 int numDst;
-	 int length;
-} instr_data_t;
+/* Builds an operand the parent sent, of the kinds the optimizer produces:
+ * registers, base-disp memory, immediates and near pc's. A rewritten
+ * base-disp operand keeps old's segment and size; a new one gets them from
+ * p2, with size 0 meaning lea's. Branches to other instructions of the
+ * block (type 10) are resolved by the caller.
+ */
+static bool
+build_opnd(int type, int64_t longParam, int p1, int p2, opnd_t old, opnd_t *result)
+{
+    switch (type) {
+    case 1:
+        *result = opnd_create_reg((reg_id_t) p1);
+        return true;
+    case 3: {
+        reg_id_t seg = DR_REG_NULL;
+        opnd_size_t size = (p2 & 0xFFFF) == 0 ? OPSZ_lea : opnd_size_from_bytes(p2 & 0xFFFF);
+        if (opnd_is_base_disp(old)) {
+            seg = opnd_get_segment(old);
+            size = opnd_get_size(old);
+        } else if ((p2 >> 16) == 1) {
+            seg = DR_SEG_FS;
+        } else if ((p2 >> 16) == 2) {
+            seg = DR_SEG_GS;
+        }
+        *result = opnd_create_far_base_disp(seg, (reg_id_t) (p1 & 0xFF), (reg_id_t) ((p1 >> 8) & 0xFF),
+                                            (p1 >> 16) & 0xFF, (int) longParam, size);
+        return true;
+    }
+    case 4:
+        *result = opnd_create_immed_int(p1, opnd_size_from_bytes(p2 == 0 ? 4 : p2));
+        return true;
+    case 5:
+        *result = opnd_create_immed_int(longParam, OPSZ_8);
+        return true;
+    case 7:
+        *result = opnd_create_pc((app_pc) longParam);
+        return true;
+    default:
+        return false;
+    }
+}
 
 void replace_src(instr_t* instr, int index, int type, int64_t longParam, int p1, int p2) {
-	// Only supports near pc's, since that's what the optimizer uses
-	if (type != 7) return;
-	instr_set_src(instr, index, opnd_create_pc((app_pc) longParam));
+	opnd_t opnd;
+	if (build_opnd(type, longParam, p1, p2, instr_get_src(instr, index), &opnd))
+		instr_set_src(instr, index, opnd);
 }
 
+/* A source the parent pointed at another instruction of the reply, by its
+ * position. Only loop back edges do this today.
+ */
+#define MAX_INTRA_TARGETS 16
+
+typedef struct {
+    instr_t *branch;
+    int src;
+    int position;
+} intra_target_t;
+
+/* Sent instead of an origIndex for an instruction the parent built: its
+ * pc, opcode, source and destination counts, then every operand
+ */
+#define REPLY_NEW_INSTR -2
+
 void print_instrlist(instrlist_t* list, void* drcontext, char* prefix) {
 	dr_fprintf(STDERR, "%s", prefix);
 	instr_t* current = instrlist_first_app(list);
@@ -201,6 +372,249 @@ void print_instrlist(instrlist_t* list, void* drcontext, char* prefix) {
 	}
 }
 
+
+/* One message of a block exchange. If the parent has gone away, stops
+ * optimizing for good; the app carries on unoptimized.
+ */
+static bool
+send_to_parent(const void *buf, int len)
+{
+    if (write(writePipe, buf, len) == len)
+        return true;
+    enable = false;
+    return false;
+}
+
+/* Returns the length of the message read, or -1 if the parent has gone away */
+static int
+recv_from_parent(void *buf, int maxLen)
+{
+    int len = read(readPipe, buf, maxLen);
+    if (len > 0)
+        return len;
+    enable = false;
+    return -1;
+}
+
+/* Tells the parent about a newly built block, without waiting for it. */
+static void
+send_block_hint(void *drcontext, instrlist_t *bb)
+{
+    unsigned char buf[HINT_MAX_SIZE];
+    int len = encode_block_hint(drcontext, bb, qos_class, buf);
+    if (len == 0) {
+        /* Too big to send atomically; the trace request will cover it */
+        return;
+    }
+    /* Never block the app on a hint: drop it if the parent is behind */
+    dr_mutex_lock(pipeLock);
+    int fl = fcntl(writePipe, F_GETFL);
+    fcntl(writePipe, F_SETFL, fl | O_NONBLOCK);
+    if (write(writePipe, buf, len) < 0 && errno != EAGAIN)
+        enable = false; /* The parent has gone away */
+    fcntl(writePipe, F_SETFL, fl);
+    dr_mutex_unlock(pipeLock);
+}
+
+/* Called on every execution of an untraced conditional branch. Threads
+ * race on the counts, which only need to be roughly right.
+ */
+static void
+count_branch(app_pc inst_addr, app_pc targ_addr, app_pc fall_addr, int taken, void *counts)
+{
+    if (taken)
+        ((branch_counts_t *)counts)->taken++;
+    else
+        ((branch_counts_t *)counts)->notTaken++;
+}
+
+/* Called on every execution of an untraced indirect jmp or call, with its
+ * counts and the target it is about to go to; racy like count_branch.
+ */
+static void
+count_indirect(void *arg, app_pc targ_addr)
+{
+    branch_counts_t *counts = (branch_counts_t *)arg;
+    counts->taken++;
+    for (int i = 0; i < INDIRECT_TARGET_SLOTS; i++) {
+        if (counts->targets[i] == NULL)
+            counts->targets[i] = targ_addr;
+        if (counts->targets[i] == targ_addr) {
+            counts->targetCounts[i]++;
+            return;
+        }
+    }
+}
+
+/* Counts executions of each block, and which way its conditional branch
+ * goes or where its indirect jmp or call lands, until it becomes part of a
+ * trace.
+ */
+static dr_emit_flags_t
+event_bb_insert(void *drcontext, void *tag, instrlist_t *bb, instr_t *instr,
+                bool for_trace, bool translating, void *user_data)
+{
+    if (for_trace || !enable)
+        return DR_EMIT_DEFAULT;
+    if (instr_is_cbr(instr) && instr_get_next_app(instr) == NULL) {
+        branch_counts_t *counts = get_branch_counts(instr_get_app_pc(instr), true);
+        dr_insert_cbr_instrumentation_ex(drcontext, bb, instr, (void *)count_branch,
+                                         OPND_CREATE_INTPTR(counts));
+    }
+    /* The target is read with the app's registers before the branch runs,
+     * which the clean call can't do for one relative to rsp
+     */
+    if (instr_is_mbr(instr) && !instr_is_return(instr) && instr_get_next_app(instr) == NULL &&
+        !opnd_uses_reg(instr_get_target(instr), DR_REG_XSP)) {
+        branch_counts_t *counts = get_branch_counts(instr_get_app_pc(instr), true);
+        dr_insert_clean_call(drcontext, bb, instr, (void *)count_indirect, false /*fpstate*/, 2,
+                             OPND_CREATE_INTPTR(counts), instr_get_target(instr));
+    }
+    if (!drmgr_is_first_instr(drcontext, instr))
+        return DR_EMIT_DEFAULT;
+    uint64_t *counter = get_exec_counter(tag, true);
+    if (!drx_insert_counter_update(drcontext, bb, instr, SPILL_SLOT_MAX + 1 /*use drreg*/,
+                                   counter, 1, DRX_COUNTER_64BIT))
+        DR_ASSERT(false);
+    return DR_EMIT_DEFAULT;
+}
+
+/* Whether instr is lea rsp, [rsp + disp] */
+static bool
+is_stack_adjust(instr_t *instr, int disp)
+{
+    if (instr_get_opcode(instr) != OP_lea || !opnd_is_reg(instr_get_dst(instr, 0)) ||
+        opnd_get_reg(instr_get_dst(instr, 0)) != DR_REG_XSP)
+        return false;
+    opnd_t addr = instr_get_src(instr, 0);
+    return opnd_is_base_disp(addr) && opnd_get_base(addr) == DR_REG_XSP &&
+        opnd_get_index(addr) == DR_REG_NULL && opnd_get_disp(addr) == disp;
+}
+
+/* The xmm register instr saves to, or restores from, its slot below the
+ * adjusted rsp, or -1
+ */
+static int
+xmm_spill_slot(instr_t *instr, bool save)
+{
+    if (instr_get_opcode(instr) != OP_movdqu)
+        return -1;
+    opnd_t reg = save ? instr_get_src(instr, 0) : instr_get_dst(instr, 0);
+    opnd_t slot = save ? instr_get_dst(instr, 0) : instr_get_src(instr, 0);
+    if (!opnd_is_reg(reg) || !opnd_is_base_disp(slot) || opnd_get_base(slot) != DR_REG_XSP ||
+        opnd_get_index(slot) != DR_REG_NULL)
+        return -1;
+    int xmm = opnd_get_reg(reg) - DR_REG_XMM0;
+    if (xmm < 0 || xmm > 1 || opnd_get_disp(slot) != xmm * 16)
+        return -1;
+    return xmm;
+}
+
+/* Packed SSE code from the parent translates to the first scalar
+ * instruction it replaces, and matches the app's state there except for rsp
+ * and the xmm registers it saved (see SLP_STACK_ADJUST). A fault or a
+ * suspension inside it finds the stack adjustment and the saves that ran
+ * before the interrupted instruction by walking the fragment up to it, and
+ * puts back the app's rsp and xmm registers, which are intact in their
+ * slots.
+ */
+static bool
+event_restore_state(void *drcontext, bool restore_memory, dr_restore_state_info_t *info)
+{
+    if (!info->raw_mcontext_valid || info->fragment_info.cache_start_pc == NULL)
+        return true;
+    bool adjusted = false;
+    /* Set right after an adjustment: the parent's is always followed by
+     * saving xmm0, which tells it apart from app code
+     */
+    bool fresh = false;
+    int saved = 0;
+    instr_t instr;
+    instr_init(drcontext, &instr);
+    byte *pc = info->fragment_info.cache_start_pc;
+    while (pc != NULL && pc <= info->raw_mcontext->pc) {
+        byte *cur = pc;
+        instr_reset(drcontext, &instr);
+        pc = decode(drcontext, pc, &instr);
+        if (pc == NULL)
+            break;
+        if (fresh && xmm_spill_slot(&instr, true) != 0)
+            adjusted = false;
+        fresh = false;
+        /* The interrupted instruction itself has not run */
+        if (cur == info->raw_mcontext->pc)
+            break;
+        if (is_stack_adjust(&instr, -SLP_STACK_ADJUST)) {
+            adjusted = true;
+            fresh = true;
+            saved = 0;
+        } else if (is_stack_adjust(&instr, SLP_STACK_ADJUST)) {
+            adjusted = false;
+        } else if (adjusted && xmm_spill_slot(&instr, true) >= 0) {
+            saved |= 1 << xmm_spill_slot(&instr, true);
+        } else if (adjusted && xmm_spill_slot(&instr, false) >= 0) {
+            saved &= ~(1 << xmm_spill_slot(&instr, false));
+        }
+    }
+    instr_free(drcontext, &instr);
+    if (!adjusted)
+        return true;
+    reg_t xsp = info->raw_mcontext->xsp;
+    for (int xmm = 0; xmm < 2; xmm++) {
+        if (saved & (1 << xmm)) {
+            dr_safe_read((void *)(xsp + xmm * 16), 16, &info->mcontext->simd[xmm],
+                         NULL);
+        }
+    }
+    info->mcontext->xsp = xsp + SLP_STACK_ADJUST;
+    return true;
+}
+
+/* Appends the scaled counts of the forward conditional branches and the
+ * indirect jmps and calls in bb that ran often enough to tell, and returns
+ * how many there are. Backward branches are left out: they are loop back
+ * edges, predicted well, and leaving them out keeps a one-block loop's
+ * request identical to its hint.
+ */
+static int
+encode_branch_profiles(instrlist_t *bb, branch_profile_t *profiles)
+{
+    int numProfiles = 0;
+    int index = 0;
+    for (instr_t *instr = instrlist_first_app(bb); instr != NULL && numProfiles < MAX_BRANCH_PROFILES;
+         instr = instr_get_next_app(instr), index++) {
+        bool indirect = instr_is_mbr(instr) && !instr_is_return(instr);
+        if (!indirect && (!instr_is_cbr(instr) || !opnd_is_pc(instr_get_target(instr)) ||
+                          opnd_get_pc(instr_get_target(instr)) <= instr_get_app_pc(instr)))
+            continue;
+        branch_counts_t *counts = get_branch_counts(instr_get_app_pc(instr), false);
+        if (counts == NULL)
+            continue;
+        uint64_t taken = counts->taken;
+        uint64_t total = taken + counts->notTaken;
+        app_pc target = NULL;
+        if (indirect) {
+            /* taken is every execution; count the dominant target's */
+            taken = 0;
+            for (int i = 0; i < INDIRECT_TARGET_SLOTS; i++) {
+                if (counts->targetCounts[i] > taken) {
+                    taken = counts->targetCounts[i];
+                    target = counts->targets[i];
+                }
+            }
+        }
+        if (total < BRANCH_PROFILE_MIN_SAMPLES)
+            continue;
+        profiles[numProfiles].index = index;
+        profiles[numProfiles].reserved = 0;
+        profiles[numProfiles].target = (uint64_t)target;
+        profiles[numProfiles].taken = (int)((taken * BRANCH_PROFILE_SCALE + total / 2) / total);
+        profiles[numProfiles].notTaken = BRANCH_PROFILE_SCALE - profiles[numProfiles].taken;
+        numProfiles++;
+    }
+    return numProfiles;
+}
+
 /* Asks its parent for optimizations to run.
  */
 static dr_emit_flags_t
@@ -210,10 +624,17 @@ event_instruction_change(void *drcontext, void *tag, instrlist_t *bb, bool for_t
     int opcode;
     instr_t *instr, *next_instr;
     /* Only bother replacing for hot code, i.e., when for_trace is true, and
-     * when the underlying microarchitecture calls for it.
+     * when the underlying microarchitecture calls for it. A block we changed
+     * has its translations stored, so DR only asks us to translate blocks we
+     * left alone; the parent may answer differently now, so don't ask it.
+     * New basic blocks are sent as hints so the parent can get ahead.
      */
-    if (!for_trace || !enable)
+    if (!enable || translating)
         return DR_EMIT_DEFAULT;
+    if (!for_trace) {
+        send_block_hint(drcontext, bb);
+        return DR_EMIT_DEFAULT;
+    }
     
     int numInstrs = 0;
     for (instr = instrlist_first_app(bb); instr != NULL; instr = next_instr) {
@@ -221,39 +642,128 @@ event_instruction_change(void *drcontext, void *tag, instrlist_t *bb, bool for_t
 	    numInstrs++;
     }
     //print_instrlist(bb, drcontext, "Before change:\n");
-    int err = write(writePipe, &numInstrs, sizeof(int));
-    unsigned char* buf = malloc(2000); 
-    err = read(readPipe, buf, 2000);
-    for (instr = instrlist_first_app(bb); instr != NULL; instr = next_instr) {
+    unsigned char* buf = malloc(HINT_MAX_SIZE);
+    block_header_t *header = (block_header_t *)buf;
+    header->numInstrs = numInstrs;
+    header->qos = qos_class;
+    uint64_t *counter = get_exec_counter(tag, false);
+    header->execCount = counter == NULL ? 0 : *counter;
+    header->numProfiles = encode_branch_profiles(bb, (branch_profile_t *)(header + 1));
+    header->flags = header->numProfiles > 0 ? BLOCK_PROFILE : 0;
+    int len = sizeof(block_header_t) + header->numProfiles * sizeof(branch_profile_t);
+    /* Opcodes, lengths and pc's are cheap to get; operands are decoded only
+     * for the instructions the parent asks for
+     */
+    bool summarized = send_summary && len + numInstrs * sizeof(instr_summary_t) <= HINT_MAX_SIZE;
+    if (summarized) {
+        header->flags |= BLOCK_SUMMARY;
+        instr_summary_t *summary = (instr_summary_t *)(buf + len);
+        for (instr = instrlist_first_app(bb); instr != NULL; instr = instr_get_next_app(instr)) {
+            summary->app_pc = instr_get_app_pc(instr);
+            summary->opcode = instr_get_opcode(instr);
+            summary->length = instr_length(drcontext, instr);
+            summary++;
+        }
+        len += numInstrs * sizeof(instr_summary_t);
+    }
+    dr_mutex_lock(pipeLock);
+    int ackLen = send_to_parent(buf, len) ? recv_from_parent(buf, HINT_MAX_SIZE) : -1;
+    /* Without a summary, the parent wants the whole block */
+    int numRanges = summarized && ackLen >= (int)sizeof(int) ? *((int *)buf) : 1;
+    if (ackLen < (int)sizeof(int) || *((int*) buf) == BLOCK_SHED || numRanges <= 0 ||
+        (summarized && ackLen < (int)(sizeof(int) + numRanges * sizeof(block_range_t)))) {
+        /* The parent is overloaded, would leave the block as it is, or has
+         * gone away
+         */
+        dr_mutex_unlock(pipeLock);
+        free(buf);
+        return DR_EMIT_DEFAULT;
+    }
+    block_range_t *ranges = malloc(numRanges * sizeof(block_range_t));
+    if (summarized) {
+        memcpy(ranges, buf + sizeof(int), numRanges * sizeof(block_range_t));
+    } else {
+        ranges[0].start = 0;
+        ranges[0].count = numInstrs;
+    }
+    int index = 0;
+    int range = 0;
+    bool ok = true;
+    for (instr = instrlist_first_app(bb); instr != NULL && range < numRanges && ok;
+         instr = next_instr, index++) {
         /* We're deleting some instrs, so get the next first. */
         next_instr = instr_get_next_app(instr);
-	instr_data_t* iData = (instr_data_t*) buf;
-        iData->app_pc = instr_get_app_pc(instr);
-	iData->opcode = instr_get_opcode(instr);
-	iData->numSrc = instr_num_srcs(instr);
-	iData->numDst = instr_num_dsts(instr);
-	iData->length = instr_length(drcontext, instr);
-	int totalOps = iData->numSrc + iData->numDst;
-	instr_opnd_t* oData = (instr_opnd_t*) (buf + sizeof(instr_data_t));
-	for (int i = 0; i < iData->numSrc; i++) {
-		parse_opnd(oData, instr_get_src(instr, i));
-		oData++;
-	}
-	for (int i = 0; i < iData->numDst; i++) {
-		parse_opnd(oData, instr_get_dst(instr, i));
-		oData++;
-	}
-	err = write(writePipe, buf, sizeof(instr_data_t) + totalOps*sizeof(instr_opnd_t));
-	err = read(readPipe, buf, sizeof(int));
+        if (index < ranges[range].start)
+            continue;
+	ok = send_to_parent(buf, encode_instr(drcontext, instr, buf)) &&
+	    recv_from_parent(buf, sizeof(int)) != -1;
+        if (index == ranges[range].start + ranges[range].count - 1)
+            range++;
+    }
+    free(ranges);
+    if (!ok || !send_to_parent(buf, sizeof(int))) {
+        dr_mutex_unlock(pipeLock);
+        free(buf);
+        return DR_EMIT_DEFAULT;
     }
-    err = write(writePipe, buf, sizeof(int));
     instrlist_t* newInsts = instrlist_create(drcontext);
+    intra_target_t intraTargets[MAX_INTRA_TARGETS];
+    int numIntraTargets = 0;
+    /* Set if the parent reordered, dropped or rewrote anything */
+    bool changed = false;
+    int expectedIndex = 0;
     while (1) {
-	err = read(readPipe, buf, 2000);
+	if (recv_from_parent(buf, 2000) < (int)sizeof(int)) {
+		ok = false;
+		break;
+	}
 	int baseIndex = *((int*) buf);
 	if (baseIndex == -1) {
 		break;
 	}
+	if (baseIndex == REPLY_NEW_INSTR) {
+		unsigned char* bufRead = buf + sizeof(int);
+		app_pc pc = *((app_pc*) bufRead);
+		bufRead += sizeof(app_pc);
+		int newOpcode = *((int*) bufRead);
+		int numSrcs = *((int*) (bufRead + sizeof(int)));
+		int numDsts = *((int*) (bufRead + 2 * sizeof(int)));
+		bufRead += 3 * sizeof(int);
+		instr_t* newInst = instr_build(drcontext, newOpcode, numDsts, numSrcs);
+		instr_set_translation(newInst, pc);
+		for (int o = 0; o < numSrcs + numDsts; o++) {
+			int type = *((int*) bufRead);
+			int64_t longParam = *((int64_t*) (bufRead + sizeof(int)));
+			int p1 = *((int*) (bufRead + sizeof(int) + sizeof(int64_t)));
+			int p2 = *((int*) (bufRead + 2 * sizeof(int) + sizeof(int64_t)));
+			bufRead += 3 * sizeof(int) + sizeof(int64_t);
+			opnd_t opnd = opnd_create_null();
+			if (type == 10 && o < numSrcs) {
+				if (numIntraTargets < MAX_INTRA_TARGETS) {
+					intraTargets[numIntraTargets].branch = newInst;
+					intraTargets[numIntraTargets].src = o;
+					intraTargets[numIntraTargets].position = p1;
+					numIntraTargets++;
+				}
+			} else {
+				build_opnd(type, longParam, p1, p2, opnd_create_null(), &opnd);
+			}
+			if (o < numSrcs)
+				instr_set_src(newInst, o, opnd);
+			else
+				instr_set_dst(newInst, o - numSrcs, opnd);
+		}
+		instrlist_append(newInsts, newInst);
+		changed = true;
+		if (!send_to_parent(buf, sizeof(int))) {
+			ok = false;
+			break;
+		}
+		continue;
+	}
+	if (baseIndex != expectedIndex++) {
+		changed = true;
+	}
 	instr_t* baseInst = instrlist_first_app(bb);
 	while (baseIndex > 0) {
 		baseInst = instr_get_next_app(baseInst);
@@ -265,6 +775,7 @@ event_instruction_change(void *drcontext, void *tag, instrlist_t *bb, bool for_t
 	bufRead += sizeof(int);
 	if (temp) {
 		//Dirty, need to make changes
+		changed = true;
 		temp = *((int*) bufRead);
 		bufRead += sizeof(int);
 		if (temp) {
@@ -287,29 +798,68 @@ event_instruction_change(void *drcontext, void *tag, instrlist_t *bb, bool for_t
 				bufRead += sizeof(int);
 				int p2 = *((int*) bufRead);
 				bufRead += sizeof(int);
-				replace_src(newInst, s, type, longParam, p1, p2);
+				if (type == 10) {
+					/* Past the limit the branch keeps its original
+					 * target, which is still correct, only slower */
+					if (numIntraTargets < MAX_INTRA_TARGETS) {
+						intraTargets[numIntraTargets].branch = newInst;
+						intraTargets[numIntraTargets].src = s;
+						intraTargets[numIntraTargets].position = p1;
+						numIntraTargets++;
+					}
+				} else {
+					replace_src(newInst, s, type, longParam, p1, p2);
+				}
 			}
 		}
 	}
 	instrlist_append(newInsts, newInst);
-	err = write(writePipe, buf, sizeof(int));
+	if (!send_to_parent(buf, sizeof(int))) {
+		ok = false;
+		break;
+	}
+    }
+    ok = ok && send_to_parent(buf, sizeof(int)) &&
+        recv_from_parent(buf, sizeof(app_pc)) == sizeof(app_pc);
+    dr_mutex_unlock(pipeLock);
+    if (!ok) {
+        /* The reply never finished, so the block stays as it was */
+        instrlist_clear_and_destroy(drcontext, newInsts);
+        free(buf);
+        return DR_EMIT_DEFAULT;
     }
-    err = write(writePipe, buf, sizeof(int));
-    err = read(readPipe, buf, sizeof(app_pc));
     app_pc new_fallthrough = *((app_pc*) buf);
+    for (int t = 0; t < numIntraTargets; t++) {
+	    instr_t* target = instrlist_first_app(newInsts);
+	    for (int p = 0; target != NULL && p < intraTargets[t].position; p++)
+		    target = instr_get_next_app(target);
+	    if (target != NULL)
+		    instr_set_src(intraTargets[t].branch, intraTargets[t].src, opnd_create_instr(target));
+    }
+    /* Move rather than clone the new instructions, so branches to other
+     * instructions in the list stay pointed at them
+     */
     instrlist_clear(drcontext, bb);
-    instr_t* copyInst = instrlist_first_app(newInsts);
-    while (copyInst != NULL) {
-	    instrlist_append(bb, instr_clone(drcontext, copyInst));
-	    copyInst = instr_get_next_app(copyInst);
+    instr_t* copyInst;
+    while ((copyInst = instrlist_first(newInsts)) != NULL) {
+	    instrlist_remove(newInsts, copyInst);
+	    instrlist_append(bb, copyInst);
     }
-    instrlist_clear_and_destroy(drcontext, newInsts);
+    instrlist_destroy(drcontext, newInsts);
     free(buf);
     if (new_fallthrough != NULL) {
 	    instrlist_set_fall_through_target(bb, new_fallthrough);
+	    changed = true;
+    }
+    if (expectedIndex != numInstrs) {
+	    changed = true;
     }
     //print_instrlist(bb, drcontext, "After change:\n");
-    return DR_EMIT_DEFAULT;
+    /* The parent may have reordered instructions, so have DR keep the
+     * translations we set rather than asking us to rebuild the block (and
+     * talk to the parent) again when a fault needs translating.
+     */
+    return changed ? DR_EMIT_STORE_TRANSLATIONS : DR_EMIT_DEFAULT;
 }
 
 static bool remove_loads(void *drcontext, instr_t *instr, instrlist_t *bb) {
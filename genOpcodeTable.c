@@ -0,0 +1,522 @@
+/* Opcode metadata generator:
+ * genOpcodeTable.c
+ *
+ * Standalone DynamoRIO program that writes opcodeTable.h for the parent.
+ * The parent can't include dr_api.h, so everything it knows about opcodes
+ * (DR opcode and register numbers, branch kinds, inverse conditions, flags,
+ * implicit registers and per-microarchitecture costs) comes from here.
+ *
+ * Usage: genOpcodeTable > opcodeTable.h
+ * Rerun after changing the spec below or moving to a new DynamoRIO release.
+ */
+
+#include "dr_api.h"
+
+#include<stdio.h>
+#include<string.h>
+
+/* Must stay in sync with the preamble printed below */
+#define OPCODE_TABLE_SIZE 2048
+#define NUM_UARCH 3
+#define ROW_MAX 256
+
+/* Compact flag bits used by the parent */
+#define FL_CF 0x01
+#define FL_PF 0x02
+#define FL_AF 0x04
+#define FL_ZF 0x08
+#define FL_SF 0x10
+#define FL_OF 0x20
+#define FL_DF 0x40
+#define FL_ARITH (FL_CF | FL_PF | FL_AF | FL_ZF | FL_SF | FL_OF)
+#define FL_ALL (FL_ARITH | FL_DF)
+
+/* Branch kinds */
+#define BR_NONE 0
+#define BR_COND 1
+#define BR_JMP 2
+#define BR_JMP_IND 3
+#define BR_CALL 4
+#define BR_CALL_IND 5
+#define BR_RET 6
+#define BR_LOOP 7
+#define BR_SYSCALL 8
+
+/* Property bits */
+#define OPI_LOAD 0x001
+#define OPI_STORE 0x002
+#define OPI_BARRIER 0x004
+#define OPI_MACRO_FUSE 0x008
+#define OPI_CTI 0x010
+#define OPI_PURE 0x020
+#define OPI_FLAGS_COND_WRITE 0x040
+#define OPI_ZERO_IDIOM 0x080
+#define OPI_COMMUTATIVE 0x100
+#define OPI_KNOWN 0x200
+
+/* GPR bits for implicit register uses, in DR_REG_RAX.. order */
+#define G_RAX 0x0001
+#define G_RCX 0x0002
+#define G_RDX 0x0004
+#define G_RBX 0x0008
+#define G_RSP 0x0010
+#define G_RBP 0x0020
+#define G_RSI 0x0040
+#define G_RDI 0x0080
+#define G_R8 0x0100
+#define G_R9 0x0200
+#define G_R10 0x0400
+#define G_R11 0x0800
+
+/* Port bits per microarchitecture:
+ * Skylake: bit n is port n.
+ * Zen 2: bits 0-3 are ALU0-3, 4-5 AGU0-1, 6 FP0/1 (mul), 7 FP2/3 (add).
+ * NetBurst: bit 0 is port 0 (fast ALU), 1 port 1 (fast ALU and complex
+ * integer), 2 the load port and 3 the store port.
+ */
+#define SKL_P0156 0x63
+#define SKL_P06 0x41
+#define SKL_P0 0x01
+#define SKL_P1 0x02
+#define SKL_P15 0x22
+#define SKL_P5 0x20
+#define SKL_P6 0x40
+#define SKL_P01 0x03
+#define SKL_P015 0x23
+#define SKL_P23 0x0C
+#define SKL_ST 0x9C
+#define ZEN_ALU 0x0F
+#define ZEN_ALU0 0x01
+#define ZEN_ALU1 0x02
+#define ZEN_ALU2 0x04
+#define ZEN_SHIFT 0x06
+#define ZEN_BR 0x09
+#define ZEN_AGU 0x30
+#define ZEN_FPMUL 0x40
+#define ZEN_FPADD 0x80
+#define ZEN_FP 0xC0
+#define P4_P01 0x03
+#define P4_P0 0x01
+#define P4_P1 0x02
+#define P4_LD 0x04
+#define P4_ST 0x08
+
+typedef struct {
+	unsigned char latency;
+	unsigned char ports;
+	unsigned char uops;
+} cost_t;
+
+typedef struct {
+	int op;
+	const char* name;
+	int branch;
+	int flagsRead;
+	int flagsWritten;
+	int regsRead;
+	int regsWritten;
+	int props;
+	cost_t cost[NUM_UARCH];
+} spec_t;
+
+#define C(lat, ports, uops) { lat, ports, uops }
+#define E(op, ...) { op, #op, __VA_ARGS__ }
+
+/* Latencies and ports follow Agner Fog's instruction tables for the
+ * register forms; memory forms add the load latency in the parent.
+ * Order of costs: Skylake, Zen 2, NetBurst.
+ */
+static const spec_t spec[] = {
+	E(OP_add, BR_NONE, 0, FL_ARITH, 0, 0, OPI_PURE | OPI_MACRO_FUSE | OPI_COMMUTATIVE,
+			{ C(1, SKL_P0156, 1), C(1, ZEN_ALU, 1), C(1, P4_P01, 1) }),
+	E(OP_or, BR_NONE, 0, FL_ARITH, 0, 0, OPI_PURE | OPI_COMMUTATIVE,
+			{ C(1, SKL_P0156, 1), C(1, ZEN_ALU, 1), C(1, P4_P1, 1) }),
+	E(OP_adc, BR_NONE, FL_CF, FL_ARITH, 0, 0, OPI_PURE,
+			{ C(1, SKL_P06, 1), C(1, ZEN_ALU, 1), C(8, P4_P1, 4) }),
+	E(OP_sbb, BR_NONE, FL_CF, FL_ARITH, 0, 0, OPI_PURE,
+			{ C(1, SKL_P06, 1), C(1, ZEN_ALU, 1), C(8, P4_P1, 4) }),
+	E(OP_and, BR_NONE, 0, FL_ARITH, 0, 0, OPI_PURE | OPI_MACRO_FUSE | OPI_COMMUTATIVE,
+			{ C(1, SKL_P0156, 1), C(1, ZEN_ALU, 1), C(1, P4_P0, 1) }),
+	E(OP_sub, BR_NONE, 0, FL_ARITH, 0, 0, OPI_PURE | OPI_MACRO_FUSE | OPI_ZERO_IDIOM,
+			{ C(1, SKL_P0156, 1), C(1, ZEN_ALU, 1), C(1, P4_P01, 1) }),
+	E(OP_xor, BR_NONE, 0, FL_ARITH, 0, 0, OPI_PURE | OPI_ZERO_IDIOM | OPI_COMMUTATIVE,
+			{ C(1, SKL_P0156, 1), C(1, ZEN_ALU, 1), C(1, P4_P0, 1) }),
+	E(OP_cmp, BR_NONE, 0, FL_ARITH, 0, 0, OPI_PURE | OPI_MACRO_FUSE,
+			{ C(1, SKL_P0156, 1), C(1, ZEN_ALU, 1), C(1, P4_P01, 1) }),
+	/* inc/dec leave CF alone, which costs a flag merge on NetBurst */
+	E(OP_inc, BR_NONE, 0, FL_ARITH & ~FL_CF, 0, 0, OPI_PURE | OPI_MACRO_FUSE,
+			{ C(1, SKL_P0156, 1), C(1, ZEN_ALU, 1), C(4, P4_P01, 2) }),
+	E(OP_dec, BR_NONE, 0, FL_ARITH & ~FL_CF, 0, 0, OPI_PURE | OPI_MACRO_FUSE,
+			{ C(1, SKL_P0156, 1), C(1, ZEN_ALU, 1), C(4, P4_P01, 2) }),
+	E(OP_push, BR_NONE, 0, 0, G_RSP, G_RSP, OPI_STORE,
+			{ C(3, SKL_ST, 1), C(3, ZEN_AGU, 1), C(2, P4_ST, 2) }),
+	E(OP_push_imm, BR_NONE, 0, 0, G_RSP, G_RSP, OPI_STORE,
+			{ C(3, SKL_ST, 1), C(3, ZEN_AGU, 1), C(2, P4_ST, 2) }),
+	E(OP_pop, BR_NONE, 0, 0, G_RSP, G_RSP, OPI_LOAD,
+			{ C(2, SKL_P23, 1), C(3, ZEN_AGU, 1), C(2, P4_LD, 2) }),
+	/* Implicit rax/rdx only for the one-operand form, which DR lists anyway */
+	E(OP_imul, BR_NONE, 0, FL_ARITH, 0, 0, OPI_PURE | OPI_COMMUTATIVE,
+			{ C(3, SKL_P1, 1), C(3, ZEN_ALU1, 1), C(14, P4_P1, 4) }),
+	E(OP_call, BR_CALL, 0, 0, G_RSP, G_RSP, OPI_CTI | OPI_STORE,
+			{ C(3, SKL_ST | SKL_P6, 2), C(3, ZEN_BR | ZEN_AGU, 2), C(5, P4_P0 | P4_ST, 3) }),
+	E(OP_call_ind, BR_CALL_IND, 0, 0, G_RSP, G_RSP, OPI_CTI | OPI_STORE,
+			{ C(3, SKL_ST | SKL_P6, 3), C(3, ZEN_BR | ZEN_AGU, 2), C(5, P4_P0 | P4_ST, 4) }),
+	E(OP_jmp, BR_JMP, 0, 0, 0, 0, OPI_CTI,
+			{ C(1, SKL_P6, 1), C(1, ZEN_BR, 1), C(1, P4_P0, 1) }),
+	E(OP_jmp_short, BR_JMP, 0, 0, 0, 0, OPI_CTI,
+			{ C(1, SKL_P6, 1), C(1, ZEN_BR, 1), C(1, P4_P0, 1) }),
+	E(OP_jmp_ind, BR_JMP_IND, 0, 0, 0, 0, OPI_CTI,
+			{ C(2, SKL_P6, 1), C(2, ZEN_BR, 1), C(2, P4_P0, 1) }),
+	E(OP_loopne, BR_LOOP, FL_ZF, 0, G_RCX, G_RCX, OPI_CTI,
+			{ C(6, SKL_P06 | SKL_P15, 7), C(1, ZEN_BR, 1), C(8, P4_P01, 4) }),
+	E(OP_loope, BR_LOOP, FL_ZF, 0, G_RCX, G_RCX, OPI_CTI,
+			{ C(6, SKL_P06 | SKL_P15, 7), C(1, ZEN_BR, 1), C(8, P4_P01, 4) }),
+	E(OP_loop, BR_LOOP, 0, 0, G_RCX, G_RCX, OPI_CTI,
+			{ C(5, SKL_P06 | SKL_P15, 7), C(1, ZEN_BR, 1), C(8, P4_P01, 4) }),
+	E(OP_jecxz, BR_LOOP, 0, 0, G_RCX, 0, OPI_CTI,
+			{ C(1, SKL_P06, 2), C(1, ZEN_BR, 1), C(2, P4_P01, 2) }),
+	E(OP_mov_ld, BR_NONE, 0, 0, 0, 0, 0,
+			{ C(5, SKL_P23, 1), C(4, ZEN_AGU, 1), C(4, P4_LD, 1) }),
+	E(OP_mov_st, BR_NONE, 0, 0, 0, 0, 0,
+			{ C(1, SKL_ST, 1), C(1, ZEN_AGU, 1), C(2, P4_ST, 1) }),
+	E(OP_mov_imm, BR_NONE, 0, 0, 0, 0, OPI_PURE,
+			{ C(1, SKL_P0156, 1), C(1, ZEN_ALU, 1), C(1, P4_P01, 1) }),
+	E(OP_test, BR_NONE, 0, FL_ARITH, 0, 0, OPI_PURE | OPI_MACRO_FUSE | OPI_COMMUTATIVE,
+			{ C(1, SKL_P0156, 1), C(1, ZEN_ALU, 1), C(1, P4_P0, 1) }),
+	E(OP_lea, BR_NONE, 0, 0, 0, 0, OPI_PURE,
+			{ C(1, SKL_P15, 1), C(1, ZEN_ALU, 1), C(4, P4_P1, 2) }),
+	/* Implicitly locked with a memory operand, so never moved */
+	E(OP_xchg, BR_NONE, 0, 0, 0, 0, OPI_BARRIER,
+			{ C(2, SKL_P0156, 3), C(1, ZEN_ALU, 2), C(2, P4_P01, 3) }),
+	E(OP_cwde, BR_NONE, 0, 0, G_RAX, G_RAX, OPI_PURE,
+			{ C(1, SKL_P0156, 1), C(1, ZEN_ALU, 1), C(1, P4_P01, 1) }),
+	E(OP_cdq, BR_NONE, 0, 0, G_RAX, G_RDX, OPI_PURE,
+			{ C(1, SKL_P06, 1), C(1, ZEN_ALU, 1), C(1, P4_P1, 1) }),
+	E(OP_pushf, BR_NONE, FL_ALL, 0, G_RSP, G_RSP, OPI_STORE,
+			{ C(3, SKL_ST | SKL_P15, 3), C(3, ZEN_AGU | ZEN_ALU, 2), C(6, P4_P1 | P4_ST, 4) }),
+	E(OP_popf, BR_NONE, 0, FL_ALL, G_RSP, G_RSP, OPI_LOAD | OPI_BARRIER,
+			{ C(20, SKL_P23 | SKL_P0156, 9), C(20, ZEN_AGU | ZEN_ALU, 35), C(52, P4_LD | P4_P1, 20) }),
+	E(OP_sahf, BR_NONE, 0, FL_CF | FL_PF | FL_AF | FL_ZF | FL_SF, G_RAX, 0, OPI_PURE,
+			{ C(1, SKL_P06, 1), C(1, ZEN_ALU, 1), C(1, P4_P01, 1) }),
+	E(OP_lahf, BR_NONE, FL_CF | FL_PF | FL_AF | FL_ZF | FL_SF, 0, 0, G_RAX, OPI_PURE,
+			{ C(1, SKL_P06, 1), C(1, ZEN_ALU, 1), C(1, P4_P01, 1) }),
+	E(OP_ret, BR_RET, 0, 0, G_RSP, G_RSP, OPI_CTI | OPI_LOAD,
+			{ C(2, SKL_P23 | SKL_P6, 2), C(2, ZEN_AGU | ZEN_BR, 2), C(8, P4_LD | P4_P0, 4) }),
+	E(OP_leave, BR_NONE, 0, 0, G_RBP, G_RSP | G_RBP, OPI_LOAD,
+			{ C(5, SKL_P23 | SKL_P0156, 3), C(4, ZEN_AGU | ZEN_ALU, 2), C(4, P4_LD | P4_P01, 3) }),
+	E(OP_int3, BR_NONE, FL_ALL, FL_ALL, 0, 0, OPI_CTI | OPI_BARRIER,
+			{ C(100, 0, 1), C(100, 0, 1), C(100, 0, 1) }),
+	E(OP_int, BR_SYSCALL, FL_ALL, FL_ALL, 0, 0, OPI_CTI | OPI_BARRIER,
+			{ C(100, 0, 1), C(100, 0, 1), C(100, 0, 1) }),
+	E(OP_hlt, BR_NONE, 0, 0, 0, 0, OPI_BARRIER,
+			{ C(100, 0, 1), C(100, 0, 1), C(100, 0, 1) }),
+	E(OP_cmc, BR_NONE, FL_CF, FL_CF, 0, 0, OPI_PURE,
+			{ C(1, SKL_P06, 1), C(1, ZEN_ALU, 1), C(1, P4_P01, 1) }),
+	E(OP_clc, BR_NONE, 0, FL_CF, 0, 0, OPI_PURE,
+			{ C(1, SKL_P0156, 1), C(1, ZEN_ALU, 1), C(1, P4_P01, 1) }),
+	E(OP_stc, BR_NONE, 0, FL_CF, 0, 0, OPI_PURE,
+			{ C(1, SKL_P0156, 1), C(1, ZEN_ALU, 1), C(1, P4_P01, 1) }),
+	E(OP_cld, BR_NONE, 0, FL_DF, 0, 0, OPI_PURE,
+			{ C(3, SKL_P0156, 3), C(1, ZEN_ALU, 1), C(1, P4_P01, 1) }),
+	E(OP_std, BR_NONE, 0, FL_DF, 0, 0, OPI_PURE,
+			{ C(3, SKL_P0156, 3), C(1, ZEN_ALU, 1), C(1, P4_P01, 1) }),
+	E(OP_syscall, BR_SYSCALL, 0, FL_ALL, G_RAX | G_RDI | G_RSI | G_RDX | G_R10 | G_R8 | G_R9,
+			G_RAX | G_RCX | G_R11, OPI_CTI | OPI_BARRIER,
+			{ C(100, 0, 1), C(100, 0, 1), C(100, 0, 1) }),
+	E(OP_ud2a, BR_NONE, 0, 0, 0, 0, OPI_BARRIER,
+			{ C(100, 0, 1), C(100, 0, 1), C(100, 0, 1) }),
+	E(OP_nop_modrm, BR_NONE, 0, 0, 0, 0, OPI_PURE,
+			{ C(0, SKL_P0156, 1), C(0, ZEN_ALU, 1), C(0, P4_P01, 1) }),
+	E(OP_rdtsc, BR_NONE, 0, 0, 0, G_RAX | G_RDX, OPI_BARRIER,
+			{ C(25, SKL_P0156, 20), C(40, ZEN_ALU, 37), C(80, P4_P1, 26) }),
+	E(OP_movd, BR_NONE, 0, 0, 0, 0, 0,
+			{ C(2, SKL_P0, 1), C(3, ZEN_FP, 1), C(2, P4_P1, 1) }),
+	E(OP_movq, BR_NONE, 0, 0, 0, 0, 0,
+			{ C(2, SKL_P0, 1), C(3, ZEN_FP, 1), C(2, P4_P1, 1) }),
+	E(OP_movdqu, BR_NONE, 0, 0, 0, 0, 0,
+			{ C(6, SKL_P23, 1), C(5, ZEN_AGU, 1), C(6, P4_LD, 1) }),
+	E(OP_movdqa, BR_NONE, 0, 0, 0, 0, 0,
+			{ C(6, SKL_P23, 1), C(5, ZEN_AGU, 1), C(6, P4_LD, 1) }),
+	E(OP_cpuid, BR_NONE, 0, 0, G_RAX | G_RCX, G_RAX | G_RBX | G_RCX | G_RDX, OPI_BARRIER,
+			{ C(100, 0, 1), C(100, 0, 1), C(100, 0, 1) }),
+	E(OP_bt, BR_NONE, 0, FL_ARITH, 0, 0, OPI_PURE,
+			{ C(1, SKL_P06, 1), C(1, ZEN_SHIFT, 1), C(8, P4_P1, 2) }),
+	E(OP_bts, BR_NONE, 0, FL_ARITH, 0, 0, OPI_PURE,
+			{ C(1, SKL_P06, 1), C(2, ZEN_SHIFT, 2), C(8, P4_P1, 3) }),
+	E(OP_btr, BR_NONE, 0, FL_ARITH, 0, 0, OPI_PURE,
+			{ C(1, SKL_P06, 1), C(2, ZEN_SHIFT, 2), C(8, P4_P1, 3) }),
+	E(OP_btc, BR_NONE, 0, FL_ARITH, 0, 0, OPI_PURE,
+			{ C(1, SKL_P06, 1), C(2, ZEN_SHIFT, 2), C(8, P4_P1, 3) }),
+	E(OP_cmpxchg, BR_NONE, 0, FL_ARITH, G_RAX, G_RAX, OPI_BARRIER,
+			{ C(5, SKL_P0156, 5), C(5, ZEN_ALU, 3), C(15, P4_P01, 5) }),
+	E(OP_movzx, BR_NONE, 0, 0, 0, 0, OPI_PURE,
+			{ C(1, SKL_P0156, 1), C(1, ZEN_ALU, 1), C(1, P4_P0, 1) }),
+	E(OP_movsx, BR_NONE, 0, 0, 0, 0, OPI_PURE,
+			{ C(1, SKL_P0156, 1), C(1, ZEN_ALU, 1), C(1, P4_P0, 1) }),
+	E(OP_bsf, BR_NONE, 0, FL_ARITH, 0, 0, OPI_PURE,
+			{ C(3, SKL_P1, 1), C(3, ZEN_ALU, 6), C(8, P4_P1, 2) }),
+	E(OP_bsr, BR_NONE, 0, FL_ARITH, 0, 0, OPI_PURE,
+			{ C(3, SKL_P1, 1), C(4, ZEN_ALU, 6), C(8, P4_P1, 2) }),
+	E(OP_xadd, BR_NONE, 0, FL_ARITH, 0, 0, OPI_BARRIER,
+			{ C(2, SKL_P0156, 3), C(1, ZEN_ALU, 2), C(2, P4_P01, 3) }),
+	E(OP_bswap, BR_NONE, 0, 0, 0, 0, OPI_PURE,
+			{ C(2, SKL_P15, 2), C(1, ZEN_ALU, 1), C(7, P4_P1, 3) }),
+	E(OP_paddq, BR_NONE, 0, 0, 0, 0, OPI_PURE | OPI_COMMUTATIVE,
+			{ C(1, SKL_P015, 1), C(1, ZEN_FP, 1), C(6, P4_P1, 2) }),
+	E(OP_pand, BR_NONE, 0, 0, 0, 0, OPI_PURE | OPI_COMMUTATIVE,
+			{ C(1, SKL_P015, 1), C(1, ZEN_FP, 1), C(2, P4_P1, 1) }),
+	E(OP_por, BR_NONE, 0, 0, 0, 0, OPI_PURE | OPI_COMMUTATIVE,
+			{ C(1, SKL_P015, 1), C(1, ZEN_FP, 1), C(2, P4_P1, 1) }),
+	E(OP_pxor, BR_NONE, 0, 0, 0, 0, OPI_PURE | OPI_ZERO_IDIOM | OPI_COMMUTATIVE,
+			{ C(1, SKL_P015, 1), C(1, ZEN_FP, 1), C(2, P4_P1, 1) }),
+	E(OP_psubd, BR_NONE, 0, 0, 0, 0, OPI_PURE | OPI_ZERO_IDIOM,
+			{ C(1, SKL_P015, 1), C(1, ZEN_FP, 1), C(2, P4_P1, 1) }),
+	E(OP_psubq, BR_NONE, 0, 0, 0, 0, OPI_PURE | OPI_ZERO_IDIOM,
+			{ C(1, SKL_P015, 1), C(1, ZEN_FP, 1), C(6, P4_P1, 2) }),
+	E(OP_paddd, BR_NONE, 0, 0, 0, 0, OPI_PURE | OPI_COMMUTATIVE,
+			{ C(1, SKL_P015, 1), C(1, ZEN_FP, 1), C(2, P4_P1, 1) }),
+	E(OP_rol, BR_NONE, 0, FL_CF | FL_OF, 0, 0, OPI_PURE | OPI_FLAGS_COND_WRITE,
+			{ C(1, SKL_P06, 1), C(1, ZEN_SHIFT, 1), C(4, P4_P1, 1) }),
+	E(OP_ror, BR_NONE, 0, FL_CF | FL_OF, 0, 0, OPI_PURE | OPI_FLAGS_COND_WRITE,
+			{ C(1, SKL_P06, 1), C(1, ZEN_SHIFT, 1), C(4, P4_P1, 1) }),
+	E(OP_rcl, BR_NONE, FL_CF, FL_CF | FL_OF, 0, 0, OPI_PURE | OPI_FLAGS_COND_WRITE,
+			{ C(2, SKL_P06, 3), C(2, ZEN_SHIFT, 3), C(7, P4_P1, 4) }),
+	E(OP_rcr, BR_NONE, FL_CF, FL_CF | FL_OF, 0, 0, OPI_PURE | OPI_FLAGS_COND_WRITE,
+			{ C(2, SKL_P06, 3), C(2, ZEN_SHIFT, 3), C(7, P4_P1, 4) }),
+	E(OP_shl, BR_NONE, 0, FL_ARITH, 0, 0, OPI_PURE | OPI_FLAGS_COND_WRITE,
+			{ C(1, SKL_P06, 1), C(1, ZEN_SHIFT, 1), C(4, P4_P1, 1) }),
+	E(OP_shr, BR_NONE, 0, FL_ARITH, 0, 0, OPI_PURE | OPI_FLAGS_COND_WRITE,
+			{ C(1, SKL_P06, 1), C(1, ZEN_SHIFT, 1), C(4, P4_P1, 1) }),
+	E(OP_sar, BR_NONE, 0, FL_ARITH, 0, 0, OPI_PURE | OPI_FLAGS_COND_WRITE,
+			{ C(1, SKL_P06, 1), C(1, ZEN_SHIFT, 1), C(4, P4_P1, 1) }),
+	E(OP_not, BR_NONE, 0, 0, 0, 0, OPI_PURE,
+			{ C(1, SKL_P0156, 1), C(1, ZEN_ALU, 1), C(1, P4_P01, 1) }),
+	E(OP_neg, BR_NONE, 0, FL_ARITH, 0, 0, OPI_PURE,
+			{ C(1, SKL_P0156, 1), C(1, ZEN_ALU, 1), C(1, P4_P01, 1) }),
+	E(OP_mul, BR_NONE, 0, FL_ARITH, G_RAX, G_RAX | G_RDX, OPI_PURE,
+			{ C(3, SKL_P1 | SKL_P5, 2), C(3, ZEN_ALU1, 2), C(14, P4_P1, 4) }),
+	/* Not pure: a zero divisor or overflow faults */
+	E(OP_div, BR_NONE, 0, FL_ARITH, G_RAX | G_RDX, G_RAX | G_RDX, 0,
+			{ C(36, SKL_P0 | SKL_P1, 36), C(30, ZEN_ALU2, 2), C(70, P4_P1, 42) }),
+	E(OP_idiv, BR_NONE, 0, FL_ARITH, G_RAX | G_RDX, G_RAX | G_RDX, 0,
+			{ C(57, SKL_P0 | SKL_P1, 57), C(45, ZEN_ALU2, 2), C(80, P4_P1, 59) }),
+	E(OP_lfence, BR_NONE, 0, 0, 0, 0, OPI_BARRIER,
+			{ C(4, SKL_P6 | SKL_P23, 2), C(1, ZEN_AGU, 1), C(4, P4_LD, 2) }),
+	E(OP_mfence, BR_NONE, 0, 0, 0, 0, OPI_BARRIER,
+			{ C(33, SKL_ST | SKL_P6, 4), C(33, ZEN_AGU, 7), C(100, P4_ST, 2) }),
+	E(OP_sfence, BR_NONE, 0, 0, 0, 0, OPI_BARRIER,
+			{ C(6, SKL_ST, 2), C(1, ZEN_AGU, 4), C(4, P4_ST, 2) }),
+	/* Prefetches have no consumers; latency is the issue cost only */
+	E(OP_prefetchnta, BR_NONE, 0, 0, 0, 0, 0,
+			{ C(0, SKL_P23, 1), C(0, ZEN_AGU, 1), C(0, P4_LD, 1) }),
+	E(OP_prefetcht0, BR_NONE, 0, 0, 0, 0, 0,
+			{ C(0, SKL_P23, 1), C(0, ZEN_AGU, 1), C(0, P4_LD, 1) }),
+	E(OP_prefetcht1, BR_NONE, 0, 0, 0, 0, 0,
+			{ C(0, SKL_P23, 1), C(0, ZEN_AGU, 1), C(0, P4_LD, 1) }),
+	E(OP_prefetcht2, BR_NONE, 0, 0, 0, 0, 0,
+			{ C(0, SKL_P23, 1), C(0, ZEN_AGU, 1), C(0, P4_LD, 1) }),
+	E(OP_prefetchw, BR_NONE, 0, 0, 0, 0, 0,
+			{ C(0, SKL_P23, 1), C(0, ZEN_AGU, 1), C(0, P4_LD, 1) }),
+	E(OP_movups, BR_NONE, 0, 0, 0, 0, 0,
+			{ C(6, SKL_P23, 1), C(5, ZEN_AGU, 1), C(6, P4_LD, 1) }),
+	E(OP_movaps, BR_NONE, 0, 0, 0, 0, 0,
+			{ C(6, SKL_P23, 1), C(5, ZEN_AGU, 1), C(6, P4_LD, 1) }),
+};
+
+/* Condition-code families, all laid out in DR's jo, jno, ... jnle order */
+static const char* condNames[16] = {
+	"o", "no", "b", "nb", "z", "nz", "be", "nbe",
+	"s", "ns", "p", "np", "l", "nl", "le", "nle"
+};
+
+static const int condFlags[16] = {
+	FL_OF, FL_OF, FL_CF, FL_CF, FL_ZF, FL_ZF, FL_CF | FL_ZF, FL_CF | FL_ZF,
+	FL_SF, FL_SF, FL_PF, FL_PF, FL_SF | FL_OF, FL_SF | FL_OF,
+	FL_ZF | FL_SF | FL_OF, FL_ZF | FL_SF | FL_OF
+};
+
+static int
+translate_eflags(uint eflags, int read)
+{
+	int flags = 0;
+	if (read) {
+		if (eflags & EFLAGS_READ_CF) flags |= FL_CF;
+		if (eflags & EFLAGS_READ_PF) flags |= FL_PF;
+		if (eflags & EFLAGS_READ_AF) flags |= FL_AF;
+		if (eflags & EFLAGS_READ_ZF) flags |= FL_ZF;
+		if (eflags & EFLAGS_READ_SF) flags |= FL_SF;
+		if (eflags & EFLAGS_READ_OF) flags |= FL_OF;
+		if (eflags & EFLAGS_READ_DF) flags |= FL_DF;
+	} else {
+		if (eflags & EFLAGS_WRITE_CF) flags |= FL_CF;
+		if (eflags & EFLAGS_WRITE_PF) flags |= FL_PF;
+		if (eflags & EFLAGS_WRITE_AF) flags |= FL_AF;
+		if (eflags & EFLAGS_WRITE_ZF) flags |= FL_ZF;
+		if (eflags & EFLAGS_WRITE_SF) flags |= FL_SF;
+		if (eflags & EFLAGS_WRITE_OF) flags |= FL_OF;
+		if (eflags & EFLAGS_WRITE_DF) flags |= FL_DF;
+	}
+	return flags;
+}
+
+/* The spec is hand-written; make sure DR agrees with it */
+static void
+check_flags(int op, const char* name, int flagsRead, int flagsWritten)
+{
+	uint eflags = instr_get_opcode_eflags(op);
+	if (translate_eflags(eflags, 1) != flagsRead || translate_eflags(eflags, 0) != flagsWritten) {
+		fprintf(stderr, "warning: %s flags differ from DR (read %#x write %#x)\n", name,
+				translate_eflags(eflags, 1), translate_eflags(eflags, 0));
+	}
+}
+
+/* Table rows by opcode, printed in order once all are known so that every
+ * index is initialized exactly once. Empty rows are printed as unknown. */
+static char rows[OPCODE_TABLE_SIZE][ROW_MAX];
+static int duplicates;
+
+static void
+print_entry(int op, const char* name, int branch, int cond, int inverse, int flagsRead,
+		int flagsWritten, int regsRead, int regsWritten, int props, const cost_t* cost)
+{
+	if (rows[op][0] != '\0') {
+		fprintf(stderr, "error: %s is listed twice\n", name);
+		duplicates++;
+		return;
+	}
+	char* row = rows[op];
+	int len = snprintf(row, ROW_MAX, "\t[%s] = { \"%s\", %d, %d, %d, %#x, %#x, %#x, %#x, %#x, {",
+			name, decode_opcode_name(op), branch, cond, inverse, flagsRead, flagsWritten,
+			regsRead, regsWritten, props | OPI_KNOWN);
+	for (int u = 0; u < NUM_UARCH; u++) {
+		len += snprintf(row + len, ROW_MAX - len, " { %d, %#x, %d }%s", cost[u].latency,
+				cost[u].ports, cost[u].uops, u == NUM_UARCH - 1 ? " " : ",");
+	}
+	snprintf(row + len, ROW_MAX - len, "} },\n");
+}
+
+static void
+print_cond_family(int base, int shortBase, const char* prefix, int branch, int written,
+		int props, const cost_t* cost)
+{
+	char name[32];
+	for (int c = 0; c < 16; c++) {
+		snprintf(name, sizeof(name), "OP_%s%s", prefix, condNames[c]);
+		print_entry(base + c, name, branch, c, base + (c ^ 1), condFlags[c], written, 0, 0,
+				props, cost);
+		if (shortBase != 0) {
+			snprintf(name, sizeof(name), "OP_%s%s_short", prefix, condNames[c]);
+			print_entry(shortBase + c, name, branch, c, shortBase + (c ^ 1), condFlags[c],
+					written, 0, 0, props, cost);
+		}
+	}
+}
+
+static void
+print_cond_defines(int base, int shortBase, const char* prefix)
+{
+	for (int c = 0; c < 16; c++) {
+		printf("#define OP_%s%s %d\n", prefix, condNames[c], base + c);
+		if (shortBase != 0) printf("#define OP_%s%s_short %d\n", prefix, condNames[c], shortBase + c);
+	}
+}
+
+int
+main(int argc, char** argv)
+{
+	dr_standalone_init();
+	if (OP_LAST >= OPCODE_TABLE_SIZE) {
+		fprintf(stderr, "OP_LAST is %d; raise OPCODE_TABLE_SIZE\n", OP_LAST);
+		return 1;
+	}
+
+	printf("/* Generated by genOpcodeTable; do not edit by hand. */\n\n");
+	printf("#ifndef OPCODE_TABLE_H\n#define OPCODE_TABLE_H\n\n");
+	printf("#include<stdint.h>\n\n");
+
+	printf("/* DynamoRIO opcode numbers */\n");
+	printf("#define OP_INVALID %d\n", OP_INVALID);
+	for (int i = 0; i < (int) (sizeof(spec) / sizeof(spec[0])); i++) {
+		printf("#define %s %d\n", spec[i].name, spec[i].op);
+	}
+	print_cond_defines(OP_jo, OP_jo_short, "j");
+	print_cond_defines(OP_seto, 0, "set");
+	print_cond_defines(OP_cmovo, 0, "cmov");
+
+	printf("\n/* DynamoRIO register numbers */\n");
+	for (reg_id_t reg = DR_REG_START_GPR; reg <= DR_REG_XMM15; reg++) {
+		const char* regName = get_register_name(reg);
+		char upper[16];
+		int len = 0;
+		for (; regName[len] != '\0' && len < 15; len++) {
+			upper[len] = (regName[len] >= 'a' && regName[len] <= 'z') ? regName[len] - 'a' + 'A' : regName[len];
+		}
+		upper[len] = '\0';
+		printf("#define DR_REG_%s %d\n", upper, reg);
+	}
+	printf("#define REG_TABLE_SIZE %d\n", DR_REG_XMM15 + 1);
+
+	printf("\n#define OPCODE_TABLE_SIZE %d\n", OPCODE_TABLE_SIZE);
+	printf("#define NUM_UARCH %d\n\n", NUM_UARCH);
+	printf("enum { UARCH_SKYLAKE, UARCH_ZEN2, UARCH_NETBURST };\n\n");
+	printf("enum { BR_NONE, BR_COND, BR_JMP, BR_JMP_IND, BR_CALL, BR_CALL_IND, BR_RET, BR_LOOP,"
+			" BR_SYSCALL };\n\n");
+	printf("#define FL_CF %#x\n#define FL_PF %#x\n#define FL_AF %#x\n#define FL_ZF %#x\n"
+			"#define FL_SF %#x\n#define FL_OF %#x\n#define FL_DF %#x\n#define FL_ARITH %#x\n"
+			"#define FL_ALL %#x\n\n", FL_CF, FL_PF, FL_AF, FL_ZF, FL_SF, FL_OF, FL_DF, FL_ARITH,
+			FL_ALL);
+	printf("/* Implicit loads and stores, things never to be moved, macro-fusible with a\n"
+			" * following jcc, control transfers, side-effect and fault free, flags left\n"
+			" * alone for a zero count, zeroing when both operands match, commutative */\n");
+	printf("#define OPI_LOAD %#x\n#define OPI_STORE %#x\n#define OPI_BARRIER %#x\n"
+			"#define OPI_MACRO_FUSE %#x\n#define OPI_CTI %#x\n#define OPI_PURE %#x\n"
+			"#define OPI_FLAGS_COND_WRITE %#x\n#define OPI_ZERO_IDIOM %#x\n"
+			"#define OPI_COMMUTATIVE %#x\n#define OPI_KNOWN %#x\n\n", OPI_LOAD, OPI_STORE,
+			OPI_BARRIER, OPI_MACRO_FUSE, OPI_CTI, OPI_PURE, OPI_FLAGS_COND_WRITE,
+			OPI_ZERO_IDIOM, OPI_COMMUTATIVE, OPI_KNOWN);
+	printf("typedef struct {\n\tuint8_t latency;\n\tuint8_t ports;\n\tuint8_t uops;\n} opcode_cost_t;\n\n");
+	printf("/* regsRead and regsWritten are bitmasks of GPRs in DR_REG_RAX.. order */\n");
+	printf("typedef struct {\n\tconst char* name;\n\tint8_t branch;\n\tint8_t cond;\n"
+			"\tint16_t inverse;\n\tuint8_t flagsRead;\n\tuint8_t flagsWritten;\n"
+			"\tuint16_t regsRead;\n\tuint16_t regsWritten;\n\tuint16_t props;\n"
+			"\topcode_cost_t cost[NUM_UARCH];\n} opcode_info_t;\n\n");
+	printf("/* Anything not listed is unknown: reads and writes every flag and is never\n"
+			" * moved, so passes stay conservative around it. */\n");
+	printf("#define OPCODE_INFO_UNKNOWN { \"?\", BR_NONE, -1, OP_INVALID, FL_ALL, FL_ALL, 0, 0,"
+			" OPI_BARRIER, { { 1, 0, 1 }, { 1, 0, 1 }, { 1, 0, 1 } } }\n\n");
+
+	for (int i = 0; i < (int) (sizeof(spec) / sizeof(spec[0])); i++) {
+		const spec_t* s = &spec[i];
+		check_flags(s->op, s->name, s->flagsRead, s->flagsWritten);
+		print_entry(s->op, s->name, s->branch, -1, OP_INVALID, s->flagsRead, s->flagsWritten,
+				s->regsRead, s->regsWritten, s->props, s->cost);
+	}
+	const cost_t jccCost[NUM_UARCH] = { C(1, SKL_P06, 1), C(1, ZEN_BR, 1), C(1, P4_P0, 1) };
+	const cost_t setCost[NUM_UARCH] = { C(1, SKL_P06, 1), C(1, ZEN_ALU, 1), C(5, P4_P1, 3) };
+	const cost_t cmovCost[NUM_UARCH] = { C(1, SKL_P06, 1), C(1, ZEN_ALU, 1), C(6, P4_P01, 3) };
+	print_cond_family(OP_jo, OP_jo_short, "j", BR_COND, 0, OPI_CTI, jccCost);
+	print_cond_family(OP_seto, 0, "set", BR_NONE, 0, OPI_PURE, setCost);
+	print_cond_family(OP_cmovo, 0, "cmov", BR_NONE, 0, OPI_PURE, cmovCost);
+	if (duplicates > 0) return 1;
+	printf("static const opcode_info_t opcodeTable[OPCODE_TABLE_SIZE] = {\n");
+	for (int op = 0; op < OPCODE_TABLE_SIZE; op++) {
+		if (rows[op][0] != '\0') printf("%s", rows[op]);
+		else printf("\t[%d] = OPCODE_INFO_UNKNOWN,\n", op);
+	}
+	printf("};\n\n");
+
+	printf("/* Where each register lives: GPR index (-1 if not a GPR), size in bytes and\n"
+			" * byte offset within the full register (1 for ah, ch, dh, bh) */\n");
+	printf("typedef struct {\n\tint8_t gpr;\n\tint8_t size;\n\tint8_t offset;\n} reg_info_t;\n\n");
+	printf("static const reg_info_t regTable[REG_TABLE_SIZE] = {\n");
+	for (reg_id_t reg = DR_REG_NULL; reg <= DR_REG_XMM15; reg++) {
+		int gpr = reg_is_gpr(reg) ? reg_to_pointer_sized(reg) - DR_REG_RAX : -1;
+		int size = reg == DR_REG_NULL ? 0 : opnd_size_in_bytes(reg_get_size(reg));
+		int offset = (reg >= DR_REG_AH && reg <= DR_REG_BH) ? 1 : 0;
+		printf("\t{ %d, %d, %d },\n", gpr, size, offset);
+	}
+	printf("};\n\n");
+	printf("#endif\n");
+	dr_standalone_exit();
+	return 0;
+}
@@ -0,0 +1,218 @@
+/* Block message encoding:
+ * instrMessage.h
+ *
+ * How DynamoRIO tools describe instructions and blocks to the parent. Shared
+ * by childProgramClient.c and aotScan.c, since a block the parent has
+ * already optimized is only recognized if its messages match byte for byte.
+ * The parent has its own copies of these structs; keep them in sync.
+ */
+
+#ifndef INSTR_MESSAGE_H
+#define INSTR_MESSAGE_H
+
+#include "dr_api.h"
+
+#include<string.h>
+
+/* Sent ahead of each block so the parent can serve the hottest and most
+ * latency-critical blocks first. Must match block_header_t in the parent.
+ */
+typedef struct {
+	int numInstrs;
+	int qos;
+	uint64_t execCount;
+	int flags;
+	int numProfiles;
+} block_header_t;
+
+#define QOS_BATCH 0
+#define QOS_DEFAULT 1
+#define QOS_LATENCY 2
+
+/* Acked instead of numInstrs when the parent is too busy for this block */
+#define BLOCK_SHED -2
+
+/* Header flags for a hint: a newly built block sent in one packet, with no
+ * reply, so the parent can optimize it before the trace it ends up in is
+ * requested. HINT_LOOP marks blocks that end in a backward branch.
+ */
+#define BLOCK_HINT 1
+#define HINT_LOOP 2
+#define HINT_MAX_SIZE 4096
+
+/* Header flag for a trace request: numProfiles branch_profile_t follow the
+ * header in the same packet, one per forward conditional branch or
+ * indirect jmp/call the client sampled enough times. The counts are scaled
+ * to add up to BRANCH_PROFILE_SCALE, so traces that behave alike send the
+ * same profile. For an indirect branch, taken counts how often it went to
+ * target, the most common of the targets it saw, and notTaken the rest.
+ */
+#define BLOCK_PROFILE 4
+#define MAX_BRANCH_PROFILES 16
+#define BRANCH_PROFILE_SCALE 16
+#define BRANCH_PROFILE_MIN_SAMPLES 32
+
+typedef struct {
+	/* Position of the branch in the block */
+	int index;
+	int taken;
+	int notTaken;
+	/* Always 0, so profiles compare byte for byte */
+	int reserved;
+	/* Indirect branches only; 0 for conditional ones */
+	uint64_t target;
+} branch_profile_t;
+
+/* Header flag for a trace request: numInstrs instr_summary_t follow the
+ * profiles in the same packet. The parent then acks with the ranges of
+ * instructions it wants described in full, an int count followed by that
+ * many block_range_t, and only those instruction messages are sent. A
+ * count of 0 means the parent would not change the block, and the
+ * exchange ends there.
+ */
+#define BLOCK_SUMMARY 8
+
+typedef struct {
+	unsigned char* app_pc;
+	int opcode;
+	int length;
+} instr_summary_t;
+
+typedef struct {
+	int start;
+	int count;
+} block_range_t;
+
+/* Packed SSE code the parent inserts borrows xmm0 and xmm1, saving them
+ * below the red zone: lea rsp, [rsp - SLP_STACK_ADJUST], then
+ * movdqu [rsp + 16 * n], xmmn, undone in reverse order afterwards. Must
+ * match SLP_STACK_ADJUST in the parent.
+ */
+#define SLP_STACK_ADJUST 160
+
+typedef struct {
+	int type;
+	int64_t longParam;
+	int p1;
+	int p2;
+} instr_opnd_t;
+
+static void parse_opnd(instr_opnd_t* dest, opnd_t src) {
+	// Padding too, so identical operands hash and compare alike
+	memset(dest, 0, sizeof(instr_opnd_t));
+	if (opnd_is_null(src)) {
+		dest->type = 0;
+	} else if (opnd_is_reg(src)) {
+		dest->type = 1;
+		dest->p1 = opnd_get_reg(src);
+	} else if (opnd_is_reg_partial(src)) {
+		dest->type = 2;
+	} else if (opnd_is_immed_int(src)) {
+		dest->type = 4;
+		dest->p1 = opnd_get_immed_int(src);
+		dest->p2 = opnd_size_in_bytes(opnd_get_size(src));
+	} else if (opnd_is_immed_int64(src)) {
+		dest->type = 5;
+		dest->longParam = opnd_get_immed_int64(src);
+	} else if (opnd_is_immed_float(src)) {
+		dest->type = 6;
+	} else if (opnd_is_near_pc(src)) {
+		dest->type = 7;
+		dest->longParam = (int64_t) opnd_get_pc(src);
+	} else if (opnd_is_far_pc(src)) {
+		dest->type = 8;
+	} else if (opnd_is_abs_addr(src) || opnd_is_rel_addr(src)) {
+		dest->type = 9;
+		dest->longParam = (int64_t) opnd_get_addr(src);
+		dest->p2 = opnd_size_in_bytes(opnd_get_size(src));
+	} else if (opnd_is_base_disp(src)) {
+		// Base, index and scale packed a byte each; size and segment in p2
+		reg_id_t seg = opnd_get_segment(src);
+		if (opnd_get_base(src) > 0xFF || opnd_get_index(src) > 0xFF) {
+			dest->type = -1;
+			return;
+		}
+		dest->type = 3;
+		dest->longParam = opnd_get_disp(src);
+		dest->p1 = opnd_get_base(src) | (opnd_get_index(src) << 8) | (opnd_get_scale(src) << 16);
+		dest->p2 = opnd_size_in_bytes(opnd_get_size(src));
+		if (seg == DR_SEG_FS) {
+			dest->p2 |= 1 << 16;
+		} else if (seg == DR_SEG_GS) {
+			dest->p2 |= 2 << 16;
+		} else if (seg != DR_REG_NULL) {
+			dest->p2 |= 3 << 16;
+		}
+	} else {
+		dest->type = -1;
+	}
+}
+
+typedef struct {
+	unsigned char* app_pc;
+	 int opcode;
+	 int numSrc;
+	 int numDst;
+	 int length;
+} instr_data_t;
+
+/* Writes the message describing instr to buf and returns its length. */
+static int
+encode_instr(void *drcontext, instr_t *instr, unsigned char *buf)
+{
+	instr_data_t* iData = (instr_data_t*) buf;
+	iData->app_pc = instr_get_app_pc(instr);
+	iData->opcode = instr_get_opcode(instr);
+	iData->numSrc = instr_num_srcs(instr);
+	iData->numDst = instr_num_dsts(instr);
+	iData->length = instr_length(drcontext, instr);
+	instr_opnd_t* oData = (instr_opnd_t*) (buf + sizeof(instr_data_t));
+	for (int i = 0; i < iData->numSrc; i++) {
+		parse_opnd(oData, instr_get_src(instr, i));
+		oData++;
+	}
+	for (int i = 0; i < iData->numDst; i++) {
+		parse_opnd(oData, instr_get_dst(instr, i));
+		oData++;
+	}
+	return sizeof(instr_data_t) + (iData->numSrc + iData->numDst) * sizeof(instr_opnd_t);
+}
+
+/* Encodes bb as a hint: a block_header_t with BLOCK_HINT set, followed by
+ * each instruction message framed as a length and a reserved word and
+ * padded to 8 bytes, which is exactly how the parent stores the messages
+ * of a block it receives. buf must hold HINT_MAX_SIZE bytes. Returns the
+ * packet length, or 0 if the block does not fit.
+ */
+static int
+encode_block_hint(void *drcontext, instrlist_t *bb, int qos, unsigned char *buf)
+{
+    block_header_t *header = (block_header_t *)buf;
+    header->numInstrs = 0;
+    header->qos = qos;
+    header->execCount = 0;
+    header->flags = BLOCK_HINT;
+    header->numProfiles = 0;
+    int len = sizeof(block_header_t);
+    instr_t *last = NULL;
+    for (instr_t *instr = instrlist_first_app(bb); instr != NULL;
+         instr = instr_get_next_app(instr)) {
+        int maxLen = sizeof(instr_data_t) +
+            (instr_num_srcs(instr) + instr_num_dsts(instr)) * sizeof(instr_opnd_t);
+        if (len + 2 * sizeof(int) + maxLen > HINT_MAX_SIZE)
+            return 0;
+        int msgLen = encode_instr(drcontext, instr, buf + len + 2 * sizeof(int));
+        ((int *)(buf + len))[0] = msgLen;
+        ((int *)(buf + len))[1] = 0;
+        len += 2 * sizeof(int) + ((msgLen + 7) & ~7);
+        header->numInstrs++;
+        last = instr;
+    }
+    if (last != NULL && (instr_is_cbr(last) || instr_is_ubr(last)) &&
+        opnd_is_pc(instr_get_target(last)) &&
+        opnd_get_pc(instr_get_target(last)) <= instr_get_app_pc(last))
+        header->flags |= HINT_LOOP;
+    return len;
+}
+
+#endif
@@ -0,0 +1,2474 @@
+/* Generated by genOpcodeTable; do not edit by hand. */
+
+#ifndef OPCODE_TABLE_H
+#define OPCODE_TABLE_H
+
+#include<stdint.h>
+
+/* DynamoRIO opcode numbers */
+#define OP_INVALID 0
+#define OP_add 4
+#define OP_or 5
+#define OP_adc 6
+#define OP_sbb 7
+#define OP_and 8
+#define OP_sub 10
+#define OP_xor 12
+#define OP_cmp 14
+#define OP_inc 16
+#define OP_dec 17
+#define OP_push 18
+#define OP_push_imm 19
+#define OP_pop 20
+#define OP_imul 25
+#define OP_call 42
+#define OP_call_ind 43
+#define OP_jmp 46
+#define OP_jmp_short 47
+#define OP_jmp_ind 48
+#define OP_loopne 51
+#define OP_loope 52
+#define OP_loop 53
+#define OP_jecxz 54
+#define OP_mov_ld 55
+#define OP_mov_st 56
+#define OP_mov_imm 57
+#define OP_test 60
+#define OP_lea 61
+#define OP_xchg 62
+#define OP_cwde 63
+#define OP_cdq 64
+#define OP_pushf 66
+#define OP_popf 67
+#define OP_sahf 68
+#define OP_lahf 69
+#define OP_ret 70
+#define OP_leave 75
+#define OP_int3 76
+#define OP_int 77
+#define OP_hlt 85
+#define OP_cmc 86
+#define OP_clc 87
+#define OP_stc 88
+#define OP_cld 91
+#define OP_std 92
+#define OP_syscall 95
+#define OP_ud2a 100
+#define OP_nop_modrm 101
+#define OP_rdtsc 105
+#define OP_movd 140
+#define OP_movq 141
+#define OP_movdqu 142
+#define OP_movdqa 143
+#define OP_cpuid 184
+#define OP_bt 185
+#define OP_bts 188
+#define OP_btr 192
+#define OP_btc 197
+#define OP_cmpxchg 190
+#define OP_movzx 195
+#define OP_movsx 200
+#define OP_bsf 198
+#define OP_bsr 199
+#define OP_xadd 201
+#define OP_bswap 205
+#define OP_paddq 209
+#define OP_pand 215
+#define OP_por 231
+#define OP_pxor 235
+#define OP_psubd 246
+#define OP_psubq 247
+#define OP_paddd 250
+#define OP_rol 253
+#define OP_ror 254
+#define OP_rcl 255
+#define OP_rcr 256
+#define OP_shl 257
+#define OP_shr 258
+#define OP_sar 259
+#define OP_not 260
+#define OP_neg 261
+#define OP_mul 262
+#define OP_div 263
+#define OP_idiv 264
+#define OP_lfence 283
+#define OP_mfence 284
+#define OP_sfence 286
+#define OP_prefetchnta 287
+#define OP_prefetcht0 288
+#define OP_prefetcht1 289
+#define OP_prefetcht2 290
+#define OP_prefetchw 292
+#define OP_movups 293
+#define OP_movaps 305
+#define OP_jo 152
+#define OP_jo_short 26
+#define OP_jno 153
+#define OP_jno_short 27
+#define OP_jb 154
+#define OP_jb_short 28
+#define OP_jnb 155
+#define OP_jnb_short 29
+#define OP_jz 156
+#define OP_jz_short 30
+#define OP_jnz 157
+#define OP_jnz_short 31
+#define OP_jbe 158
+#define OP_jbe_short 32
+#define OP_jnbe 159
+#define OP_jnbe_short 33
+#define OP_js 160
+#define OP_js_short 34
+#define OP_jns 161
+#define OP_jns_short 35
+#define OP_jp 162
+#define OP_jp_short 36
+#define OP_jnp 163
+#define OP_jnp_short 37
+#define OP_jl 164
+#define OP_jl_short 38
+#define OP_jnl 165
+#define OP_jnl_short 39
+#define OP_jle 166
+#define OP_jle_short 40
+#define OP_jnle 167
+#define OP_jnle_short 41
+#define OP_seto 168
+#define OP_setno 169
+#define OP_setb 170
+#define OP_setnb 171
+#define OP_setz 172
+#define OP_setnz 173
+#define OP_setbe 174
+#define OP_setnbe 175
+#define OP_sets 176
+#define OP_setns 177
+#define OP_setp 178
+#define OP_setnp 179
+#define OP_setl 180
+#define OP_setnl 181
+#define OP_setle 182
+#define OP_setnle 183
+#define OP_cmovo 110
+#define OP_cmovno 111
+#define OP_cmovb 112
+#define OP_cmovnb 113
+#define OP_cmovz 114
+#define OP_cmovnz 115
+#define OP_cmovbe 116
+#define OP_cmovnbe 117
+#define OP_cmovs 118
+#define OP_cmovns 119
+#define OP_cmovp 120
+#define OP_cmovnp 121
+#define OP_cmovl 122
+#define OP_cmovnl 123
+#define OP_cmovle 124
+#define OP_cmovnle 125
+
+/* DynamoRIO register numbers */
+#define DR_REG_RAX 1
+#define DR_REG_RCX 2
+#define DR_REG_RDX 3
+#define DR_REG_RBX 4
+#define DR_REG_RSP 5
+#define DR_REG_RBP 6
+#define DR_REG_RSI 7
+#define DR_REG_RDI 8
+#define DR_REG_R8 9
+#define DR_REG_R9 10
+#define DR_REG_R10 11
+#define DR_REG_R11 12
+#define DR_REG_R12 13
+#define DR_REG_R13 14
+#define DR_REG_R14 15
+#define DR_REG_R15 16
+#define DR_REG_EAX 17
+#define DR_REG_ECX 18
+#define DR_REG_EDX 19
+#define DR_REG_EBX 20
+#define DR_REG_ESP 21
+#define DR_REG_EBP 22
+#define DR_REG_ESI 23
+#define DR_REG_EDI 24
+#define DR_REG_R8D 25
+#define DR_REG_R9D 26
+#define DR_REG_R10D 27
+#define DR_REG_R11D 28
+#define DR_REG_R12D 29
+#define DR_REG_R13D 30
+#define DR_REG_R14D 31
+#define DR_REG_R15D 32
+#define DR_REG_AX 33
+#define DR_REG_CX 34
+#define DR_REG_DX 35
+#define DR_REG_BX 36
+#define DR_REG_SP 37
+#define DR_REG_BP 38
+#define DR_REG_SI 39
+#define DR_REG_DI 40
+#define DR_REG_R8W 41
+#define DR_REG_R9W 42
+#define DR_REG_R10W 43
+#define DR_REG_R11W 44
+#define DR_REG_R12W 45
+#define DR_REG_R13W 46
+#define DR_REG_R14W 47
+#define DR_REG_R15W 48
+#define DR_REG_AL 49
+#define DR_REG_CL 50
+#define DR_REG_DL 51
+#define DR_REG_BL 52
+#define DR_REG_AH 53
+#define DR_REG_CH 54
+#define DR_REG_DH 55
+#define DR_REG_BH 56
+#define DR_REG_R8L 57
+#define DR_REG_R9L 58
+#define DR_REG_R10L 59
+#define DR_REG_R11L 60
+#define DR_REG_R12L 61
+#define DR_REG_R13L 62
+#define DR_REG_R14L 63
+#define DR_REG_R15L 64
+#define DR_REG_SPL 65
+#define DR_REG_BPL 66
+#define DR_REG_SIL 67
+#define DR_REG_DIL 68
+#define DR_REG_MM0 69
+#define DR_REG_MM1 70
+#define DR_REG_MM2 71
+#define DR_REG_MM3 72
+#define DR_REG_MM4 73
+#define DR_REG_MM5 74
+#define DR_REG_MM6 75
+#define DR_REG_MM7 76
+#define DR_REG_XMM0 77
+#define DR_REG_XMM1 78
+#define DR_REG_XMM2 79
+#define DR_REG_XMM3 80
+#define DR_REG_XMM4 81
+#define DR_REG_XMM5 82
+#define DR_REG_XMM6 83
+#define DR_REG_XMM7 84
+#define DR_REG_XMM8 85
+#define DR_REG_XMM9 86
+#define DR_REG_XMM10 87
+#define DR_REG_XMM11 88
+#define DR_REG_XMM12 89
+#define DR_REG_XMM13 90
+#define DR_REG_XMM14 91
+#define DR_REG_XMM15 92
+#define REG_TABLE_SIZE 93
+
+#define OPCODE_TABLE_SIZE 2048
+#define NUM_UARCH 3
+
+enum { UARCH_SKYLAKE, UARCH_ZEN2, UARCH_NETBURST };
+
+enum { BR_NONE, BR_COND, BR_JMP, BR_JMP_IND, BR_CALL, BR_CALL_IND, BR_RET, BR_LOOP, BR_SYSCALL };
+
+#define FL_CF 0x1
+#define FL_PF 0x2
+#define FL_AF 0x4
+#define FL_ZF 0x8
+#define FL_SF 0x10
+#define FL_OF 0x20
+#define FL_DF 0x40
+#define FL_ARITH 0x3f
+#define FL_ALL 0x7f
+
+/* Implicit loads and stores, things never to be moved, macro-fusible with a
+ * following jcc, control transfers, side-effect and fault free, flags left
+ * alone for a zero count, zeroing when both operands match, commutative */
+#define OPI_LOAD 0x1
+#define OPI_STORE 0x2
+#define OPI_BARRIER 0x4
+#define OPI_MACRO_FUSE 0x8
+#define OPI_CTI 0x10
+#define OPI_PURE 0x20
+#define OPI_FLAGS_COND_WRITE 0x40
+#define OPI_ZERO_IDIOM 0x80
+#define OPI_COMMUTATIVE 0x100
+#define OPI_KNOWN 0x200
+
+typedef struct {
+	uint8_t latency;
+	uint8_t ports;
+	uint8_t uops;
+} opcode_cost_t;
+
+/* regsRead and regsWritten are bitmasks of GPRs in DR_REG_RAX.. order */
+typedef struct {
+	const char* name;
+	int8_t branch;
+	int8_t cond;
+	int16_t inverse;
+	uint8_t flagsRead;
+	uint8_t flagsWritten;
+	uint16_t regsRead;
+	uint16_t regsWritten;
+	uint16_t props;
+	opcode_cost_t cost[NUM_UARCH];
+} opcode_info_t;
+
+/* Anything not listed is unknown: reads and writes every flag and is never
+ * moved, so passes stay conservative around it. */
+#define OPCODE_INFO_UNKNOWN { "?", BR_NONE, -1, OP_INVALID, FL_ALL, FL_ALL, 0, 0, OPI_BARRIER, { { 1, 0, 1 }, { 1, 0, 1 }, { 1, 0, 1 } } }
+
+static const opcode_info_t opcodeTable[OPCODE_TABLE_SIZE] = {
+	[0] = OPCODE_INFO_UNKNOWN,
+	[1] = OPCODE_INFO_UNKNOWN,
+	[2] = OPCODE_INFO_UNKNOWN,
+	[3] = OPCODE_INFO_UNKNOWN,
+	[OP_add] = { "add", 0, -1, 0, 0, 0x3f, 0, 0, 0x328, { { 1, 0x63, 1 }, { 1, 0xf, 1 }, { 1, 0x3, 1 } } },
+	[OP_or] = { "or", 0, -1, 0, 0, 0x3f, 0, 0, 0x320, { { 1, 0x63, 1 }, { 1, 0xf, 1 }, { 1, 0x2, 1 } } },
+	[OP_adc] = { "adc", 0, -1, 0, 0x1, 0x3f, 0, 0, 0x220, { { 1, 0x41, 1 }, { 1, 0xf, 1 }, { 8, 0x2, 4 } } },
+	[OP_sbb] = { "sbb", 0, -1, 0, 0x1, 0x3f, 0, 0, 0x220, { { 1, 0x41, 1 }, { 1, 0xf, 1 }, { 8, 0x2, 4 } } },
+	[OP_and] = { "and", 0, -1, 0, 0, 0x3f, 0, 0, 0x328, { { 1, 0x63, 1 }, { 1, 0xf, 1 }, { 1, 0x1, 1 } } },
+	[9] = OPCODE_INFO_UNKNOWN,
+	[OP_sub] = { "sub", 0, -1, 0, 0, 0x3f, 0, 0, 0x2a8, { { 1, 0x63, 1 }, { 1, 0xf, 1 }, { 1, 0x3, 1 } } },
+	[11] = OPCODE_INFO_UNKNOWN,
+	[OP_xor] = { "xor", 0, -1, 0, 0, 0x3f, 0, 0, 0x3a0, { { 1, 0x63, 1 }, { 1, 0xf, 1 }, { 1, 0x1, 1 } } },
+	[13] = OPCODE_INFO_UNKNOWN,
+	[OP_cmp] = { "cmp", 0, -1, 0, 0, 0x3f, 0, 0, 0x228, { { 1, 0x63, 1 }, { 1, 0xf, 1 }, { 1, 0x3, 1 } } },
+	[15] = OPCODE_INFO_UNKNOWN,
+	[OP_inc] = { "inc", 0, -1, 0, 0, 0x3e, 0, 0, 0x228, { { 1, 0x63, 1 }, { 1, 0xf, 1 }, { 4, 0x3, 2 } } },
+	[OP_dec] = { "dec", 0, -1, 0, 0, 0x3e, 0, 0, 0x228, { { 1, 0x63, 1 }, { 1, 0xf, 1 }, { 4, 0x3, 2 } } },
+	[OP_push] = { "push", 0, -1, 0, 0, 0, 0x10, 0x10, 0x202, { { 3, 0x9c, 1 }, { 3, 0x30, 1 }, { 2, 0x8, 2 } } },
+	[OP_push_imm] = { "push_imm", 0, -1, 0, 0, 0, 0x10, 0x10, 0x202, { { 3, 0x9c, 1 }, { 3, 0x30, 1 }, { 2, 0x8, 2 } } },
+	[OP_pop] = { "pop", 0, -1, 0, 0, 0, 0x10, 0x10, 0x201, { { 2, 0xc, 1 }, { 3, 0x30, 1 }, { 2, 0x4, 2 } } },
+	[21] = OPCODE_INFO_UNKNOWN,
+	[22] = OPCODE_INFO_UNKNOWN,
+	[23] = OPCODE_INFO_UNKNOWN,
+	[24] = OPCODE_INFO_UNKNOWN,
+	[OP_imul] = { "imul", 0, -1, 0, 0, 0x3f, 0, 0, 0x320, { { 3, 0x2, 1 }, { 3, 0x2, 1 }, { 14, 0x2, 4 } } },
+	[OP_jo_short] = { "jo", 1, 0, 27, 0x20, 0, 0, 0, 0x210, { { 1, 0x41, 1 }, { 1, 0x9, 1 }, { 1, 0x1, 1 } } },
+	[OP_jno_short] = { "jno", 1, 1, 26, 0x20, 0, 0, 0, 0x210, { { 1, 0x41, 1 }, { 1, 0x9, 1 }, { 1, 0x1, 1 } } },
+	[OP_jb_short] = { "jb", 1, 2, 29, 0x1, 0, 0, 0, 0x210, { { 1, 0x41, 1 }, { 1, 0x9, 1 }, { 1, 0x1, 1 } } },
+	[OP_jnb_short] = { "jnb", 1, 3, 28, 0x1, 0, 0, 0, 0x210, { { 1, 0x41, 1 }, { 1, 0x9, 1 }, { 1, 0x1, 1 } } },
+	[OP_jz_short] = { "jz", 1, 4, 31, 0x8, 0, 0, 0, 0x210, { { 1, 0x41, 1 }, { 1, 0x9, 1 }, { 1, 0x1, 1 } } },
+	[OP_jnz_short] = { "jnz", 1, 5, 30, 0x8, 0, 0, 0, 0x210, { { 1, 0x41, 1 }, { 1, 0x9, 1 }, { 1, 0x1, 1 } } },
+	[OP_jbe_short] = { "jbe", 1, 6, 33, 0x9, 0, 0, 0, 0x210, { { 1, 0x41, 1 }, { 1, 0x9, 1 }, { 1, 0x1, 1 } } },
+	[OP_jnbe_short] = { "jnbe", 1, 7, 32, 0x9, 0, 0, 0, 0x210, { { 1, 0x41, 1 }, { 1, 0x9, 1 }, { 1, 0x1, 1 } } },
+	[OP_js_short] = { "js", 1, 8, 35, 0x10, 0, 0, 0, 0x210, { { 1, 0x41, 1 }, { 1, 0x9, 1 }, { 1, 0x1, 1 } } },
+	[OP_jns_short] = { "jns", 1, 9, 34, 0x10, 0, 0, 0, 0x210, { { 1, 0x41, 1 }, { 1, 0x9, 1 }, { 1, 0x1, 1 } } },
+	[OP_jp_short] = { "jp", 1, 10, 37, 0x2, 0, 0, 0, 0x210, { { 1, 0x41, 1 }, { 1, 0x9, 1 }, { 1, 0x1, 1 } } },
+	[OP_jnp_short] = { "jnp", 1, 11, 36, 0x2, 0, 0, 0, 0x210, { { 1, 0x41, 1 }, { 1, 0x9, 1 }, { 1, 0x1, 1 } } },
+	[OP_jl_short] = { "jl", 1, 12, 39, 0x30, 0, 0, 0, 0x210, { { 1, 0x41, 1 }, { 1, 0x9, 1 }, { 1, 0x1, 1 } } },
+	[OP_jnl_short] = { "jnl", 1, 13, 38, 0x30, 0, 0, 0, 0x210, { { 1, 0x41, 1 }, { 1, 0x9, 1 }, { 1, 0x1, 1 } } },
+	[OP_jle_short] = { "jle", 1, 14, 41, 0x38, 0, 0, 0, 0x210, { { 1, 0x41, 1 }, { 1, 0x9, 1 }, { 1, 0x1, 1 } } },
+	[OP_jnle_short] = { "jnle", 1, 15, 40, 0x38, 0, 0, 0, 0x210, { { 1, 0x41, 1 }, { 1, 0x9, 1 }, { 1, 0x1, 1 } } },
+	[OP_call] = { "call", 4, -1, 0, 0, 0, 0x10, 0x10, 0x212, { { 3, 0xdc, 2 }, { 3, 0x39, 2 }, { 5, 0x9, 3 } } },
+	[OP_call_ind] = { "call_ind", 5, -1, 0, 0, 0, 0x10, 0x10, 0x212, { { 3, 0xdc, 3 }, { 3, 0x39, 2 }, { 5, 0x9, 4 } } },
+	[44] = OPCODE_INFO_UNKNOWN,
+	[45] = OPCODE_INFO_UNKNOWN,
+	[OP_jmp] = { "jmp", 2, -1, 0, 0, 0, 0, 0, 0x210, { { 1, 0x40, 1 }, { 1, 0x9, 1 }, { 1, 0x1, 1 } } },
+	[OP_jmp_short] = { "jmp", 2, -1, 0, 0, 0, 0, 0, 0x210, { { 1, 0x40, 1 }, { 1, 0x9, 1 }, { 1, 0x1, 1 } } },
+	[OP_jmp_ind] = { "jmp_ind", 3, -1, 0, 0, 0, 0, 0, 0x210, { { 2, 0x40, 1 }, { 2, 0x9, 1 }, { 2, 0x1, 1 } } },
+	[49] = OPCODE_INFO_UNKNOWN,
+	[50] = OPCODE_INFO_UNKNOWN,
+	[OP_loopne] = { "loopne", 7, -1, 0, 0x8, 0, 0x2, 0x2, 0x210, { { 6, 0x63, 7 }, { 1, 0x9, 1 }, { 8, 0x3, 4 } } },
+	[OP_loope] = { "loope", 7, -1, 0, 0x8, 0, 0x2, 0x2, 0x210, { { 6, 0x63, 7 }, { 1, 0x9, 1 }, { 8, 0x3, 4 } } },
+	[OP_loop] = { "loop", 7, -1, 0, 0, 0, 0x2, 0x2, 0x210, { { 5, 0x63, 7 }, { 1, 0x9, 1 }, { 8, 0x3, 4 } } },
+	[OP_jecxz] = { "jecxz", 7, -1, 0, 0, 0, 0x2, 0, 0x210, { { 1, 0x41, 2 }, { 1, 0x9, 1 }, { 2, 0x3, 2 } } },
+	[OP_mov_ld] = { "mov", 0, -1, 0, 0, 0, 0, 0, 0x200, { { 5, 0xc, 1 }, { 4, 0x30, 1 }, { 4, 0x4, 1 } } },
+	[OP_mov_st] = { "mov", 0, -1, 0, 0, 0, 0, 0, 0x200, { { 1, 0x9c, 1 }, { 1, 0x30, 1 }, { 2, 0x8, 1 } } },
+	[OP_mov_imm] = { "mov", 0, -1, 0, 0, 0, 0, 0, 0x220, { { 1, 0x63, 1 }, { 1, 0xf, 1 }, { 1, 0x3, 1 } } },
+	[58] = OPCODE_INFO_UNKNOWN,
+	[59] = OPCODE_INFO_UNKNOWN,
+	[OP_test] = { "test", 0, -1, 0, 0, 0x3f, 0, 0, 0x328, { { 1, 0x63, 1 }, { 1, 0xf, 1 }, { 1, 0x1, 1 } } },
+	[OP_lea] = { "lea", 0, -1, 0, 0, 0, 0, 0, 0x220, { { 1, 0x22, 1 }, { 1, 0xf, 1 }, { 4, 0x2, 2 } } },
+	[OP_xchg] = { "xchg", 0, -1, 0, 0, 0, 0, 0, 0x204, { { 2, 0x63, 3 }, { 1, 0xf, 2 }, { 2, 0x3, 3 } } },
+	[OP_cwde] = { "cwde", 0, -1, 0, 0, 0, 0x1, 0x1, 0x220, { { 1, 0x63, 1 }, { 1, 0xf, 1 }, { 1, 0x3, 1 } } },
+	[OP_cdq] = { "cdq", 0, -1, 0, 0, 0, 0x1, 0x4, 0x220, { { 1, 0x41, 1 }, { 1, 0xf, 1 }, { 1, 0x2, 1 } } },
+	[65] = OPCODE_INFO_UNKNOWN,
+	[OP_pushf] = { "pushf", 0, -1, 0, 0x7f, 0, 0x10, 0x10, 0x202, { { 3, 0xbe, 3 }, { 3, 0x3f, 2 }, { 6, 0xa, 4 } } },
+	[OP_popf] = { "popf", 0, -1, 0, 0, 0x7f, 0x10, 0x10, 0x205, { { 20, 0x6f, 9 }, { 20, 0x3f, 35 }, { 52, 0x6, 20 } } },
+	[OP_sahf] = { "sahf", 0, -1, 0, 0, 0x1f, 0x1, 0, 0x220, { { 1, 0x41, 1 }, { 1, 0xf, 1 }, { 1, 0x3, 1 } } },
+	[OP_lahf] = { "lahf", 0, -1, 0, 0x1f, 0, 0, 0x1, 0x220, { { 1, 0x41, 1 }, { 1, 0xf, 1 }, { 1, 0x3, 1 } } },
+	[OP_ret] = { "ret", 6, -1, 0, 0, 0, 0x10, 0x10, 0x211, { { 2, 0x4c, 2 }, { 2, 0x39, 2 }, { 8, 0x5, 4 } } },
+	[71] = OPCODE_INFO_UNKNOWN,
+	[72] = OPCODE_INFO_UNKNOWN,
+	[73] = OPCODE_INFO_UNKNOWN,
+	[74] = OPCODE_INFO_UNKNOWN,
+	[OP_leave] = { "leave", 0, -1, 0, 0, 0, 0x20, 0x30, 0x201, { { 5, 0x6f, 3 }, { 4, 0x3f, 2 }, { 4, 0x7, 3 } } },
+	[OP_int3] = { "int3", 0, -1, 0, 0x7f, 0x7f, 0, 0, 0x214, { { 100, 0, 1 }, { 100, 0, 1 }, { 100, 0, 1 } } },
+	[OP_int] = { "int", 8, -1, 0, 0x7f, 0x7f, 0, 0, 0x214, { { 100, 0, 1 }, { 100, 0, 1 }, { 100, 0, 1 } } },
+	[78] = OPCODE_INFO_UNKNOWN,
+	[79] = OPCODE_INFO_UNKNOWN,
+	[80] = OPCODE_INFO_UNKNOWN,
+	[81] = OPCODE_INFO_UNKNOWN,
+	[82] = OPCODE_INFO_UNKNOWN,
+	[83] = OPCODE_INFO_UNKNOWN,
+	[84] = OPCODE_INFO_UNKNOWN,
+	[OP_hlt] = { "hlt", 0, -1, 0, 0, 0, 0, 0, 0x204, { { 100, 0, 1 }, { 100, 0, 1 }, { 100, 0, 1 } } },
+	[OP_cmc] = { "cmc", 0, -1, 0, 0x1, 0x1, 0, 0, 0x220, { { 1, 0x41, 1 }, { 1, 0xf, 1 }, { 1, 0x3, 1 } } },
+	[OP_clc] = { "clc", 0, -1, 0, 0, 0x1, 0, 0, 0x220, { { 1, 0x63, 1 }, { 1, 0xf, 1 }, { 1, 0x3, 1 } } },
+	[OP_stc] = { "stc", 0, -1, 0, 0, 0x1, 0, 0, 0x220, { { 1, 0x63, 1 }, { 1, 0xf, 1 }, { 1, 0x3, 1 } } },
+	[89] = OPCODE_INFO_UNKNOWN,
+	[90] = OPCODE_INFO_UNKNOWN,
+	[OP_cld] = { "cld", 0, -1, 0, 0, 0x40, 0, 0, 0x220, { { 3, 0x63, 3 }, { 1, 0xf, 1 }, { 1, 0x3, 1 } } },
+	[OP_std] = { "std", 0, -1, 0, 0, 0x40, 0, 0, 0x220, { { 3, 0x63, 3 }, { 1, 0xf, 1 }, { 1, 0x3, 1 } } },
+	[93] = OPCODE_INFO_UNKNOWN,
+	[94] = OPCODE_INFO_UNKNOWN,
+	[OP_syscall] = { "syscall", 8, -1, 0, 0, 0x7f, 0x7c5, 0x803, 0x214, { { 100, 0, 1 }, { 100, 0, 1 }, { 100, 0, 1 } } },
+	[96] = OPCODE_INFO_UNKNOWN,
+	[97] = OPCODE_INFO_UNKNOWN,
+	[98] = OPCODE_INFO_UNKNOWN,
+	[99] = OPCODE_INFO_UNKNOWN,
+	[OP_ud2a] = { "ud2a", 0, -1, 0, 0, 0, 0, 0, 0x204, { { 100, 0, 1 }, { 100, 0, 1 }, { 100, 0, 1 } } },
+	[OP_nop_modrm] = { "nop_modrm", 0, -1, 0, 0, 0, 0, 0, 0x220, { { 0, 0x63, 1 }, { 0, 0xf, 1 }, { 0, 0x3, 1 } } },
+	[102] = OPCODE_INFO_UNKNOWN,
+	[103] = OPCODE_INFO_UNKNOWN,
+	[104] = OPCODE_INFO_UNKNOWN,
+	[OP_rdtsc] = { "rdtsc", 0, -1, 0, 0, 0, 0, 0x5, 0x204, { { 25, 0x63, 20 }, { 40, 0xf, 37 }, { 80, 0x2, 26 } } },
+	[106] = OPCODE_INFO_UNKNOWN,
+	[107] = OPCODE_INFO_UNKNOWN,
+	[108] = OPCODE_INFO_UNKNOWN,
+	[109] = OPCODE_INFO_UNKNOWN,
+	[OP_cmovo] = { "cmovo", 0, 0, 111, 0x20, 0, 0, 0, 0x220, { { 1, 0x41, 1 }, { 1, 0xf, 1 }, { 6, 0x3, 3 } } },
+	[OP_cmovno] = { "cmovno", 0, 1, 110, 0x20, 0, 0, 0, 0x220, { { 1, 0x41, 1 }, { 1, 0xf, 1 }, { 6, 0x3, 3 } } },
+	[OP_cmovb] = { "cmovb", 0, 2, 113, 0x1, 0, 0, 0, 0x220, { { 1, 0x41, 1 }, { 1, 0xf, 1 }, { 6, 0x3, 3 } } },
+	[OP_cmovnb] = { "cmovnb", 0, 3, 112, 0x1, 0, 0, 0, 0x220, { { 1, 0x41, 1 }, { 1, 0xf, 1 }, { 6, 0x3, 3 } } },
+	[OP_cmovz] = { "cmovz", 0, 4, 115, 0x8, 0, 0, 0, 0x220, { { 1, 0x41, 1 }, { 1, 0xf, 1 }, { 6, 0x3, 3 } } },
+	[OP_cmovnz] = { "cmovnz", 0, 5, 114, 0x8, 0, 0, 0, 0x220, { { 1, 0x41, 1 }, { 1, 0xf, 1 }, { 6, 0x3, 3 } } },
+	[OP_cmovbe] = { "cmovbe", 0, 6, 117, 0x9, 0, 0, 0, 0x220, { { 1, 0x41, 1 }, { 1, 0xf, 1 }, { 6, 0x3, 3 } } },
+	[OP_cmovnbe] = { "cmovnbe", 0, 7, 116, 0x9, 0, 0, 0, 0x220, { { 1, 0x41, 1 }, { 1, 0xf, 1 }, { 6, 0x3, 3 } } },
+	[OP_cmovs] = { "cmovs", 0, 8, 119, 0x10, 0, 0, 0, 0x220, { { 1, 0x41, 1 }, { 1, 0xf, 1 }, { 6, 0x3, 3 } } },
+	[OP_cmovns] = { "cmovns", 0, 9, 118, 0x10, 0, 0, 0, 0x220, { { 1, 0x41, 1 }, { 1, 0xf, 1 }, { 6, 0x3, 3 } } },
+	[OP_cmovp] = { "cmovp", 0, 10, 121, 0x2, 0, 0, 0, 0x220, { { 1, 0x41, 1 }, { 1, 0xf, 1 }, { 6, 0x3, 3 } } },
+	[OP_cmovnp] = { "cmovnp", 0, 11, 120, 0x2, 0, 0, 0, 0x220, { { 1, 0x41, 1 }, { 1, 0xf, 1 }, { 6, 0x3, 3 } } },
+	[OP_cmovl] = { "cmovl", 0, 12, 123, 0x30, 0, 0, 0, 0x220, { { 1, 0x41, 1 }, { 1, 0xf, 1 }, { 6, 0x3, 3 } } },
+	[OP_cmovnl] = { "cmovnl", 0, 13, 122, 0x30, 0, 0, 0, 0x220, { { 1, 0x41, 1 }, { 1, 0xf, 1 }, { 6, 0x3, 3 } } },
+	[OP_cmovle] = { "cmovle", 0, 14, 125, 0x38, 0, 0, 0, 0x220, { { 1, 0x41, 1 }, { 1, 0xf, 1 }, { 6, 0x3, 3 } } },
+	[OP_cmovnle] = { "cmovnle", 0, 15, 124, 0x38, 0, 0, 0, 0x220, { { 1, 0x41, 1 }, { 1, 0xf, 1 }, { 6, 0x3, 3 } } },
+	[126] = OPCODE_INFO_UNKNOWN,
+	[127] = OPCODE_INFO_UNKNOWN,
+	[128] = OPCODE_INFO_UNKNOWN,
+	[129] = OPCODE_INFO_UNKNOWN,
+	[130] = OPCODE_INFO_UNKNOWN,
+	[131] = OPCODE_INFO_UNKNOWN,
+	[132] = OPCODE_INFO_UNKNOWN,
+	[133] = OPCODE_INFO_UNKNOWN,
+	[134] = OPCODE_INFO_UNKNOWN,
+	[135] = OPCODE_INFO_UNKNOWN,
+	[136] = OPCODE_INFO_UNKNOWN,
+	[137] = OPCODE_INFO_UNKNOWN,
+	[138] = OPCODE_INFO_UNKNOWN,
+	[139] = OPCODE_INFO_UNKNOWN,
+	[OP_movd] = { "movd", 0, -1, 0, 0, 0, 0, 0, 0x200, { { 2, 0x1, 1 }, { 3, 0xc0, 1 }, { 2, 0x2, 1 } } },
+	[OP_movq] = { "movq", 0, -1, 0, 0, 0, 0, 0, 0x200, { { 2, 0x1, 1 }, { 3, 0xc0, 1 }, { 2, 0x2, 1 } } },
+	[OP_movdqu] = { "movdqu", 0, -1, 0, 0, 0, 0, 0, 0x200, { { 6, 0xc, 1 }, { 5, 0x30, 1 }, { 6, 0x4, 1 } } },
+	[OP_movdqa] = { "movdqa", 0, -1, 0, 0, 0, 0, 0, 0x200, { { 6, 0xc, 1 }, { 5, 0x30, 1 }, { 6, 0x4, 1 } } },
+	[144] = OPCODE_INFO_UNKNOWN,
+	[145] = OPCODE_INFO_UNKNOWN,
+	[146] = OPCODE_INFO_UNKNOWN,
+	[147] = OPCODE_INFO_UNKNOWN,
+	[148] = OPCODE_INFO_UNKNOWN,
+	[149] = OPCODE_INFO_UNKNOWN,
+	[150] = OPCODE_INFO_UNKNOWN,
+	[151] = OPCODE_INFO_UNKNOWN,
+	[OP_jo] = { "jo", 1, 0, 153, 0x20, 0, 0, 0, 0x210, { { 1, 0x41, 1 }, { 1, 0x9, 1 }, { 1, 0x1, 1 } } },
+	[OP_jno] = { "jno", 1, 1, 152, 0x20, 0, 0, 0, 0x210, { { 1, 0x41, 1 }, { 1, 0x9, 1 }, { 1, 0x1, 1 } } },
+	[OP_jb] = { "jb", 1, 2, 155, 0x1, 0, 0, 0, 0x210, { { 1, 0x41, 1 }, { 1, 0x9, 1 }, { 1, 0x1, 1 } } },
+	[OP_jnb] = { "jnb", 1, 3, 154, 0x1, 0, 0, 0, 0x210, { { 1, 0x41, 1 }, { 1, 0x9, 1 }, { 1, 0x1, 1 } } },
+	[OP_jz] = { "jz", 1, 4, 157, 0x8, 0, 0, 0, 0x210, { { 1, 0x41, 1 }, { 1, 0x9, 1 }, { 1, 0x1, 1 } } },
+	[OP_jnz] = { "jnz", 1, 5, 156, 0x8, 0, 0, 0, 0x210, { { 1, 0x41, 1 }, { 1, 0x9, 1 }, { 1, 0x1, 1 } } },
+	[OP_jbe] = { "jbe", 1, 6, 159, 0x9, 0, 0, 0, 0x210, { { 1, 0x41, 1 }, { 1, 0x9, 1 }, { 1, 0x1, 1 } } },
+	[OP_jnbe] = { "jnbe", 1, 7, 158, 0x9, 0, 0, 0, 0x210, { { 1, 0x41, 1 }, { 1, 0x9, 1 }, { 1, 0x1, 1 } } },
+	[OP_js] = { "js", 1, 8, 161, 0x10, 0, 0, 0, 0x210, { { 1, 0x41, 1 }, { 1, 0x9, 1 }, { 1, 0x1, 1 } } },
+	[OP_jns] = { "jns", 1, 9, 160, 0x10, 0, 0, 0, 0x210, { { 1, 0x41, 1 }, { 1, 0x9, 1 }, { 1, 0x1, 1 } } },
+	[OP_jp] = { "jp", 1, 10, 163, 0x2, 0, 0, 0, 0x210, { { 1, 0x41, 1 }, { 1, 0x9, 1 }, { 1, 0x1, 1 } } },
+	[OP_jnp] = { "jnp", 1, 11, 162, 0x2, 0, 0, 0, 0x210, { { 1, 0x41, 1 }, { 1, 0x9, 1 }, { 1, 0x1, 1 } } },
+	[OP_jl] = { "jl", 1, 12, 165, 0x30, 0, 0, 0, 0x210, { { 1, 0x41, 1 }, { 1, 0x9, 1 }, { 1, 0x1, 1 } } },
+	[OP_jnl] = { "jnl", 1, 13, 164, 0x30, 0, 0, 0, 0x210, { { 1, 0x41, 1 }, { 1, 0x9, 1 }, { 1, 0x1, 1 } } },
+	[OP_jle] = { "jle", 1, 14, 167, 0x38, 0, 0, 0, 0x210, { { 1, 0x41, 1 }, { 1, 0x9, 1 }, { 1, 0x1, 1 } } },
+	[OP_jnle] = { "jnle", 1, 15, 166, 0x38, 0, 0, 0, 0x210, { { 1, 0x41, 1 }, { 1, 0x9, 1 }, { 1, 0x1, 1 } } },
+	[OP_seto] = { "seto", 0, 0, 169, 0x20, 0, 0, 0, 0x220, { { 1, 0x41, 1 }, { 1, 0xf, 1 }, { 5, 0x2, 3 } } },
+	[OP_setno] = { "setno", 0, 1, 168, 0x20, 0, 0, 0, 0x220, { { 1, 0x41, 1 }, { 1, 0xf, 1 }, { 5, 0x2, 3 } } },
+	[OP_setb] = { "setb", 0, 2, 171, 0x1, 0, 0, 0, 0x220, { { 1, 0x41, 1 }, { 1, 0xf, 1 }, { 5, 0x2, 3 } } },
+	[OP_setnb] = { "setnb", 0, 3, 170, 0x1, 0, 0, 0, 0x220, { { 1, 0x41, 1 }, { 1, 0xf, 1 }, { 5, 0x2, 3 } } },
+	[OP_setz] = { "setz", 0, 4, 173, 0x8, 0, 0, 0, 0x220, { { 1, 0x41, 1 }, { 1, 0xf, 1 }, { 5, 0x2, 3 } } },
+	[OP_setnz] = { "setnz", 0, 5, 172, 0x8, 0, 0, 0, 0x220, { { 1, 0x41, 1 }, { 1, 0xf, 1 }, { 5, 0x2, 3 } } },
+	[OP_setbe] = { "setbe", 0, 6, 175, 0x9, 0, 0, 0, 0x220, { { 1, 0x41, 1 }, { 1, 0xf, 1 }, { 5, 0x2, 3 } } },
+	[OP_setnbe] = { "setnbe", 0, 7, 174, 0x9, 0, 0, 0, 0x220, { { 1, 0x41, 1 }, { 1, 0xf, 1 }, { 5, 0x2, 3 } } },
+	[OP_sets] = { "sets", 0, 8, 177, 0x10, 0, 0, 0, 0x220, { { 1, 0x41, 1 }, { 1, 0xf, 1 }, { 5, 0x2, 3 } } },
+	[OP_setns] = { "setns", 0, 9, 176, 0x10, 0, 0, 0, 0x220, { { 1, 0x41, 1 }, { 1, 0xf, 1 }, { 5, 0x2, 3 } } },
+	[OP_setp] = { "setp", 0, 10, 179, 0x2, 0, 0, 0, 0x220, { { 1, 0x41, 1 }, { 1, 0xf, 1 }, { 5, 0x2, 3 } } },
+	[OP_setnp] = { "setnp", 0, 11, 178, 0x2, 0, 0, 0, 0x220, { { 1, 0x41, 1 }, { 1, 0xf, 1 }, { 5, 0x2, 3 } } },
+	[OP_setl] = { "setl", 0, 12, 181, 0x30, 0, 0, 0, 0x220, { { 1, 0x41, 1 }, { 1, 0xf, 1 }, { 5, 0x2, 3 } } },
+	[OP_setnl] = { "setnl", 0, 13, 180, 0x30, 0, 0, 0, 0x220, { { 1, 0x41, 1 }, { 1, 0xf, 1 }, { 5, 0x2, 3 } } },
+	[OP_setle] = { "setle", 0, 14, 183, 0x38, 0, 0, 0, 0x220, { { 1, 0x41, 1 }, { 1, 0xf, 1 }, { 5, 0x2, 3 } } },
+	[OP_setnle] = { "setnle", 0, 15, 182, 0x38, 0, 0, 0, 0x220, { { 1, 0x41, 1 }, { 1, 0xf, 1 }, { 5, 0x2, 3 } } },
+	[OP_cpuid] = { "cpuid", 0, -1, 0, 0, 0, 0x3, 0xf, 0x204, { { 100, 0, 1 }, { 100, 0, 1 }, { 100, 0, 1 } } },
+	[OP_bt] = { "bt", 0, -1, 0, 0, 0x3f, 0, 0, 0x220, { { 1, 0x41, 1 }, { 1, 0x6, 1 }, { 8, 0x2, 2 } } },
+	[186] = OPCODE_INFO_UNKNOWN,
+	[187] = OPCODE_INFO_UNKNOWN,
+	[OP_bts] = { "bts", 0, -1, 0, 0, 0x3f, 0, 0, 0x220, { { 1, 0x41, 1 }, { 2, 0x6, 2 }, { 8, 0x2, 3 } } },
+	[189] = OPCODE_INFO_UNKNOWN,
+	[OP_cmpxchg] = { "cmpxchg", 0, -1, 0, 0, 0x3f, 0x1, 0x1, 0x204, { { 5, 0x63, 5 }, { 5, 0xf, 3 }, { 15, 0x3, 5 } } },
+	[191] = OPCODE_INFO_UNKNOWN,
+	[OP_btr] = { "btr", 0, -1, 0, 0, 0x3f, 0, 0, 0x220, { { 1, 0x41, 1 }, { 2, 0x6, 2 }, { 8, 0x2, 3 } } },
+	[193] = OPCODE_INFO_UNKNOWN,
+	[194] = OPCODE_INFO_UNKNOWN,
+	[OP_movzx] = { "movzx", 0, -1, 0, 0, 0, 0, 0, 0x220, { { 1, 0x63, 1 }, { 1, 0xf, 1 }, { 1, 0x1, 1 } } },
+	[196] = OPCODE_INFO_UNKNOWN,
+	[OP_btc] = { "btc", 0, -1, 0, 0, 0x3f, 0, 0, 0x220, { { 1, 0x41, 1 }, { 2, 0x6, 2 }, { 8, 0x2, 3 } } },
+	[OP_bsf] = { "bsf", 0, -1, 0, 0, 0x3f, 0, 0, 0x220, { { 3, 0x2, 1 }, { 3, 0xf, 6 }, { 8, 0x2, 2 } } },
+	[OP_bsr] = { "bsr", 0, -1, 0, 0, 0x3f, 0, 0, 0x220, { { 3, 0x2, 1 }, { 4, 0xf, 6 }, { 8, 0x2, 2 } } },
+	[OP_movsx] = { "movsx", 0, -1, 0, 0, 0, 0, 0, 0x220, { { 1, 0x63, 1 }, { 1, 0xf, 1 }, { 1, 0x1, 1 } } },
+	[OP_xadd] = { "xadd", 0, -1, 0, 0, 0x3f, 0, 0, 0x204, { { 2, 0x63, 3 }, { 1, 0xf, 2 }, { 2, 0x3, 3 } } },
+	[202] = OPCODE_INFO_UNKNOWN,
+	[203] = OPCODE_INFO_UNKNOWN,
+	[204] = OPCODE_INFO_UNKNOWN,
+	[OP_bswap] = { "bswap", 0, -1, 0, 0, 0, 0, 0, 0x220, { { 2, 0x22, 2 }, { 1, 0xf, 1 }, { 7, 0x2, 3 } } },
+	[206] = OPCODE_INFO_UNKNOWN,
+	[207] = OPCODE_INFO_UNKNOWN,
+	[208] = OPCODE_INFO_UNKNOWN,
+	[OP_paddq] = { "paddq", 0, -1, 0, 0, 0, 0, 0, 0x320, { { 1, 0x23, 1 }, { 1, 0xc0, 1 }, { 6, 0x2, 2 } } },
+	[210] = OPCODE_INFO_UNKNOWN,
+	[211] = OPCODE_INFO_UNKNOWN,
+	[212] = OPCODE_INFO_UNKNOWN,
+	[213] = OPCODE_INFO_UNKNOWN,
+	[214] = OPCODE_INFO_UNKNOWN,
+	[OP_pand] = { "pand", 0, -1, 0, 0, 0, 0, 0, 0x320, { { 1, 0x23, 1 }, { 1, 0xc0, 1 }, { 2, 0x2, 1 } } },
+	[216] = OPCODE_INFO_UNKNOWN,
+	[217] = OPCODE_INFO_UNKNOWN,
+	[218] = OPCODE_INFO_UNKNOWN,
+	[219] = OPCODE_INFO_UNKNOWN,
+	[220] = OPCODE_INFO_UNKNOWN,
+	[221] = OPCODE_INFO_UNKNOWN,
+	[222] = OPCODE_INFO_UNKNOWN,
+	[223] = OPCODE_INFO_UNKNOWN,
+	[224] = OPCODE_INFO_UNKNOWN,
+	[225] = OPCODE_INFO_UNKNOWN,
+	[226] = OPCODE_INFO_UNKNOWN,
+	[227] = OPCODE_INFO_UNKNOWN,
+	[228] = OPCODE_INFO_UNKNOWN,
+	[229] = OPCODE_INFO_UNKNOWN,
+	[230] = OPCODE_INFO_UNKNOWN,
+	[OP_por] = { "por", 0, -1, 0, 0, 0, 0, 0, 0x320, { { 1, 0x23, 1 }, { 1, 0xc0, 1 }, { 2, 0x2, 1 } } },
+	[232] = OPCODE_INFO_UNKNOWN,
+	[233] = OPCODE_INFO_UNKNOWN,
+	[234] = OPCODE_INFO_UNKNOWN,
+	[OP_pxor] = { "pxor", 0, -1, 0, 0, 0, 0, 0, 0x3a0, { { 1, 0x23, 1 }, { 1, 0xc0, 1 }, { 2, 0x2, 1 } } },
+	[236] = OPCODE_INFO_UNKNOWN,
+	[237] = OPCODE_INFO_UNKNOWN,
+	[238] = OPCODE_INFO_UNKNOWN,
+	[239] = OPCODE_INFO_UNKNOWN,
+	[240] = OPCODE_INFO_UNKNOWN,
+	[241] = OPCODE_INFO_UNKNOWN,
+	[242] = OPCODE_INFO_UNKNOWN,
+	[243] = OPCODE_INFO_UNKNOWN,
+	[244] = OPCODE_INFO_UNKNOWN,
+	[245] = OPCODE_INFO_UNKNOWN,
+	[OP_psubd] = { "psubd", 0, -1, 0, 0, 0, 0, 0, 0x2a0, { { 1, 0x23, 1 }, { 1, 0xc0, 1 }, { 2, 0x2, 1 } } },
+	[OP_psubq] = { "psubq", 0, -1, 0, 0, 0, 0, 0, 0x2a0, { { 1, 0x23, 1 }, { 1, 0xc0, 1 }, { 6, 0x2, 2 } } },
+	[248] = OPCODE_INFO_UNKNOWN,
+	[249] = OPCODE_INFO_UNKNOWN,
+	[OP_paddd] = { "paddd", 0, -1, 0, 0, 0, 0, 0, 0x320, { { 1, 0x23, 1 }, { 1, 0xc0, 1 }, { 2, 0x2, 1 } } },
+	[251] = OPCODE_INFO_UNKNOWN,
+	[252] = OPCODE_INFO_UNKNOWN,
+	[OP_rol] = { "rol", 0, -1, 0, 0, 0x21, 0, 0, 0x260, { { 1, 0x41, 1 }, { 1, 0x6, 1 }, { 4, 0x2, 1 } } },
+	[OP_ror] = { "ror", 0, -1, 0, 0, 0x21, 0, 0, 0x260, { { 1, 0x41, 1 }, { 1, 0x6, 1 }, { 4, 0x2, 1 } } },
+	[OP_rcl] = { "rcl", 0, -1, 0, 0x1, 0x21, 0, 0, 0x260, { { 2, 0x41, 3 }, { 2, 0x6, 3 }, { 7, 0x2, 4 } } },
+	[OP_rcr] = { "rcr", 0, -1, 0, 0x1, 0x21, 0, 0, 0x260, { { 2, 0x41, 3 }, { 2, 0x6, 3 }, { 7, 0x2, 4 } } },
+	[OP_shl] = { "shl", 0, -1, 0, 0, 0x3f, 0, 0, 0x260, { { 1, 0x41, 1 }, { 1, 0x6, 1 }, { 4, 0x2, 1 } } },
+	[OP_shr] = { "shr", 0, -1, 0, 0, 0x3f, 0, 0, 0x260, { { 1, 0x41, 1 }, { 1, 0x6, 1 }, { 4, 0x2, 1 } } },
+	[OP_sar] = { "sar", 0, -1, 0, 0, 0x3f, 0, 0, 0x260, { { 1, 0x41, 1 }, { 1, 0x6, 1 }, { 4, 0x2, 1 } } },
+	[OP_not] = { "not", 0, -1, 0, 0, 0, 0, 0, 0x220, { { 1, 0x63, 1 }, { 1, 0xf, 1 }, { 1, 0x3, 1 } } },
+	[OP_neg] = { "neg", 0, -1, 0, 0, 0x3f, 0, 0, 0x220, { { 1, 0x63, 1 }, { 1, 0xf, 1 }, { 1, 0x3, 1 } } },
+	[OP_mul] = { "mul", 0, -1, 0, 0, 0x3f, 0x1, 0x5, 0x220, { { 3, 0x22, 2 }, { 3, 0x2, 2 }, { 14, 0x2, 4 } } },
+	[OP_div] = { "div", 0, -1, 0, 0, 0x3f, 0x5, 0x5, 0x200, { { 36, 0x3, 36 }, { 30, 0x4, 2 }, { 70, 0x2, 42 } } },
+	[OP_idiv] = { "idiv", 0, -1, 0, 0, 0x3f, 0x5, 0x5, 0x200, { { 57, 0x3, 57 }, { 45, 0x4, 2 }, { 80, 0x2, 59 } } },
+	[265] = OPCODE_INFO_UNKNOWN,
+	[266] = OPCODE_INFO_UNKNOWN,
+	[267] = OPCODE_INFO_UNKNOWN,
+	[268] = OPCODE_INFO_UNKNOWN,
+	[269] = OPCODE_INFO_UNKNOWN,
+	[270] = OPCODE_INFO_UNKNOWN,
+	[271] = OPCODE_INFO_UNKNOWN,
+	[272] = OPCODE_INFO_UNKNOWN,
+	[273] = OPCODE_INFO_UNKNOWN,
+	[274] = OPCODE_INFO_UNKNOWN,
+	[275] = OPCODE_INFO_UNKNOWN,
+	[276] = OPCODE_INFO_UNKNOWN,
+	[277] = OPCODE_INFO_UNKNOWN,
+	[278] = OPCODE_INFO_UNKNOWN,
+	[279] = OPCODE_INFO_UNKNOWN,
+	[280] = OPCODE_INFO_UNKNOWN,
+	[281] = OPCODE_INFO_UNKNOWN,
+	[282] = OPCODE_INFO_UNKNOWN,
+	[OP_lfence] = { "lfence", 0, -1, 0, 0, 0, 0, 0, 0x204, { { 4, 0x4c, 2 }, { 1, 0x30, 1 }, { 4, 0x4, 2 } } },
+	[OP_mfence] = { "mfence", 0, -1, 0, 0, 0, 0, 0, 0x204, { { 33, 0xdc, 4 }, { 33, 0x30, 7 }, { 100, 0x8, 2 } } },
+	[285] = OPCODE_INFO_UNKNOWN,
+	[OP_sfence] = { "sfence", 0, -1, 0, 0, 0, 0, 0, 0x204, { { 6, 0x9c, 2 }, { 1, 0x30, 4 }, { 4, 0x8, 2 } } },
+	[OP_prefetchnta] = { "prefetchnta", 0, -1, 0, 0, 0, 0, 0, 0x200, { { 0, 0xc, 1 }, { 0, 0x30, 1 }, { 0, 0x4, 1 } } },
+	[OP_prefetcht0] = { "prefetcht0", 0, -1, 0, 0, 0, 0, 0, 0x200, { { 0, 0xc, 1 }, { 0, 0x30, 1 }, { 0, 0x4, 1 } } },
+	[OP_prefetcht1] = { "prefetcht1", 0, -1, 0, 0, 0, 0, 0, 0x200, { { 0, 0xc, 1 }, { 0, 0x30, 1 }, { 0, 0x4, 1 } } },
+	[OP_prefetcht2] = { "prefetcht2", 0, -1, 0, 0, 0, 0, 0, 0x200, { { 0, 0xc, 1 }, { 0, 0x30, 1 }, { 0, 0x4, 1 } } },
+	[291] = OPCODE_INFO_UNKNOWN,
+	[OP_prefetchw] = { "prefetchw", 0, -1, 0, 0, 0, 0, 0, 0x200, { { 0, 0xc, 1 }, { 0, 0x30, 1 }, { 0, 0x4, 1 } } },
+	[OP_movups] = { "movups", 0, -1, 0, 0, 0, 0, 0, 0x200, { { 6, 0xc, 1 }, { 5, 0x30, 1 }, { 6, 0x4, 1 } } },
+	[294] = OPCODE_INFO_UNKNOWN,
+	[295] = OPCODE_INFO_UNKNOWN,
+	[296] = OPCODE_INFO_UNKNOWN,
+	[297] = OPCODE_INFO_UNKNOWN,
+	[298] = OPCODE_INFO_UNKNOWN,
+	[299] = OPCODE_INFO_UNKNOWN,
+	[300] = OPCODE_INFO_UNKNOWN,
+	[301] = OPCODE_INFO_UNKNOWN,
+	[302] = OPCODE_INFO_UNKNOWN,
+	[303] = OPCODE_INFO_UNKNOWN,
+	[304] = OPCODE_INFO_UNKNOWN,
+	[OP_movaps] = { "movaps", 0, -1, 0, 0, 0, 0, 0, 0x200, { { 6, 0xc, 1 }, { 5, 0x30, 1 }, { 6, 0x4, 1 } } },
+	[306] = OPCODE_INFO_UNKNOWN,
+	[307] = OPCODE_INFO_UNKNOWN,
+	[308] = OPCODE_INFO_UNKNOWN,
+	[309] = OPCODE_INFO_UNKNOWN,
+	[310] = OPCODE_INFO_UNKNOWN,
+	[311] = OPCODE_INFO_UNKNOWN,
+	[312] = OPCODE_INFO_UNKNOWN,
+	[313] = OPCODE_INFO_UNKNOWN,
+	[314] = OPCODE_INFO_UNKNOWN,
+	[315] = OPCODE_INFO_UNKNOWN,
+	[316] = OPCODE_INFO_UNKNOWN,
+	[317] = OPCODE_INFO_UNKNOWN,
+	[318] = OPCODE_INFO_UNKNOWN,
+	[319] = OPCODE_INFO_UNKNOWN,
+	[320] = OPCODE_INFO_UNKNOWN,
+	[321] = OPCODE_INFO_UNKNOWN,
+	[322] = OPCODE_INFO_UNKNOWN,
+	[323] = OPCODE_INFO_UNKNOWN,
+	[324] = OPCODE_INFO_UNKNOWN,
+	[325] = OPCODE_INFO_UNKNOWN,
+	[326] = OPCODE_INFO_UNKNOWN,
+	[327] = OPCODE_INFO_UNKNOWN,
+	[328] = OPCODE_INFO_UNKNOWN,
+	[329] = OPCODE_INFO_UNKNOWN,
+	[330] = OPCODE_INFO_UNKNOWN,
+	[331] = OPCODE_INFO_UNKNOWN,
+	[332] = OPCODE_INFO_UNKNOWN,
+	[333] = OPCODE_INFO_UNKNOWN,
+	[334] = OPCODE_INFO_UNKNOWN,
+	[335] = OPCODE_INFO_UNKNOWN,
+	[336] = OPCODE_INFO_UNKNOWN,
+	[337] = OPCODE_INFO_UNKNOWN,
+	[338] = OPCODE_INFO_UNKNOWN,
+	[339] = OPCODE_INFO_UNKNOWN,
+	[340] = OPCODE_INFO_UNKNOWN,
+	[341] = OPCODE_INFO_UNKNOWN,
+	[342] = OPCODE_INFO_UNKNOWN,
+	[343] = OPCODE_INFO_UNKNOWN,
+	[344] = OPCODE_INFO_UNKNOWN,
+	[345] = OPCODE_INFO_UNKNOWN,
+	[346] = OPCODE_INFO_UNKNOWN,
+	[347] = OPCODE_INFO_UNKNOWN,
+	[348] = OPCODE_INFO_UNKNOWN,
+	[349] = OPCODE_INFO_UNKNOWN,
+	[350] = OPCODE_INFO_UNKNOWN,
+	[351] = OPCODE_INFO_UNKNOWN,
+	[352] = OPCODE_INFO_UNKNOWN,
+	[353] = OPCODE_INFO_UNKNOWN,
+	[354] = OPCODE_INFO_UNKNOWN,
+	[355] = OPCODE_INFO_UNKNOWN,
+	[356] = OPCODE_INFO_UNKNOWN,
+	[357] = OPCODE_INFO_UNKNOWN,
+	[358] = OPCODE_INFO_UNKNOWN,
+	[359] = OPCODE_INFO_UNKNOWN,
+	[360] = OPCODE_INFO_UNKNOWN,
+	[361] = OPCODE_INFO_UNKNOWN,
+	[362] = OPCODE_INFO_UNKNOWN,
+	[363] = OPCODE_INFO_UNKNOWN,
+	[364] = OPCODE_INFO_UNKNOWN,
+	[365] = OPCODE_INFO_UNKNOWN,
+	[366] = OPCODE_INFO_UNKNOWN,
+	[367] = OPCODE_INFO_UNKNOWN,
+	[368] = OPCODE_INFO_UNKNOWN,
+	[369] = OPCODE_INFO_UNKNOWN,
+	[370] = OPCODE_INFO_UNKNOWN,
+	[371] = OPCODE_INFO_UNKNOWN,
+	[372] = OPCODE_INFO_UNKNOWN,
+	[373] = OPCODE_INFO_UNKNOWN,
+	[374] = OPCODE_INFO_UNKNOWN,
+	[375] = OPCODE_INFO_UNKNOWN,
+	[376] = OPCODE_INFO_UNKNOWN,
+	[377] = OPCODE_INFO_UNKNOWN,
+	[378] = OPCODE_INFO_UNKNOWN,
+	[379] = OPCODE_INFO_UNKNOWN,
+	[380] = OPCODE_INFO_UNKNOWN,
+	[381] = OPCODE_INFO_UNKNOWN,
+	[382] = OPCODE_INFO_UNKNOWN,
+	[383] = OPCODE_INFO_UNKNOWN,
+	[384] = OPCODE_INFO_UNKNOWN,
+	[385] = OPCODE_INFO_UNKNOWN,
+	[386] = OPCODE_INFO_UNKNOWN,
+	[387] = OPCODE_INFO_UNKNOWN,
+	[388] = OPCODE_INFO_UNKNOWN,
+	[389] = OPCODE_INFO_UNKNOWN,
+	[390] = OPCODE_INFO_UNKNOWN,
+	[391] = OPCODE_INFO_UNKNOWN,
+	[392] = OPCODE_INFO_UNKNOWN,
+	[393] = OPCODE_INFO_UNKNOWN,
+	[394] = OPCODE_INFO_UNKNOWN,
+	[395] = OPCODE_INFO_UNKNOWN,
+	[396] = OPCODE_INFO_UNKNOWN,
+	[397] = OPCODE_INFO_UNKNOWN,
+	[398] = OPCODE_INFO_UNKNOWN,
+	[399] = OPCODE_INFO_UNKNOWN,
+	[400] = OPCODE_INFO_UNKNOWN,
+	[401] = OPCODE_INFO_UNKNOWN,
+	[402] = OPCODE_INFO_UNKNOWN,
+	[403] = OPCODE_INFO_UNKNOWN,
+	[404] = OPCODE_INFO_UNKNOWN,
+	[405] = OPCODE_INFO_UNKNOWN,
+	[406] = OPCODE_INFO_UNKNOWN,
+	[407] = OPCODE_INFO_UNKNOWN,
+	[408] = OPCODE_INFO_UNKNOWN,
+	[409] = OPCODE_INFO_UNKNOWN,
+	[410] = OPCODE_INFO_UNKNOWN,
+	[411] = OPCODE_INFO_UNKNOWN,
+	[412] = OPCODE_INFO_UNKNOWN,
+	[413] = OPCODE_INFO_UNKNOWN,
+	[414] = OPCODE_INFO_UNKNOWN,
+	[415] = OPCODE_INFO_UNKNOWN,
+	[416] = OPCODE_INFO_UNKNOWN,
+	[417] = OPCODE_INFO_UNKNOWN,
+	[418] = OPCODE_INFO_UNKNOWN,
+	[419] = OPCODE_INFO_UNKNOWN,
+	[420] = OPCODE_INFO_UNKNOWN,
+	[421] = OPCODE_INFO_UNKNOWN,
+	[422] = OPCODE_INFO_UNKNOWN,
+	[423] = OPCODE_INFO_UNKNOWN,
+	[424] = OPCODE_INFO_UNKNOWN,
+	[425] = OPCODE_INFO_UNKNOWN,
+	[426] = OPCODE_INFO_UNKNOWN,
+	[427] = OPCODE_INFO_UNKNOWN,
+	[428] = OPCODE_INFO_UNKNOWN,
+	[429] = OPCODE_INFO_UNKNOWN,
+	[430] = OPCODE_INFO_UNKNOWN,
+	[431] = OPCODE_INFO_UNKNOWN,
+	[432] = OPCODE_INFO_UNKNOWN,
+	[433] = OPCODE_INFO_UNKNOWN,
+	[434] = OPCODE_INFO_UNKNOWN,
+	[435] = OPCODE_INFO_UNKNOWN,
+	[436] = OPCODE_INFO_UNKNOWN,
+	[437] = OPCODE_INFO_UNKNOWN,
+	[438] = OPCODE_INFO_UNKNOWN,
+	[439] = OPCODE_INFO_UNKNOWN,
+	[440] = OPCODE_INFO_UNKNOWN,
+	[441] = OPCODE_INFO_UNKNOWN,
+	[442] = OPCODE_INFO_UNKNOWN,
+	[443] = OPCODE_INFO_UNKNOWN,
+	[444] = OPCODE_INFO_UNKNOWN,
+	[445] = OPCODE_INFO_UNKNOWN,
+	[446] = OPCODE_INFO_UNKNOWN,
+	[447] = OPCODE_INFO_UNKNOWN,
+	[448] = OPCODE_INFO_UNKNOWN,
+	[449] = OPCODE_INFO_UNKNOWN,
+	[450] = OPCODE_INFO_UNKNOWN,
+	[451] = OPCODE_INFO_UNKNOWN,
+	[452] = OPCODE_INFO_UNKNOWN,
+	[453] = OPCODE_INFO_UNKNOWN,
+	[454] = OPCODE_INFO_UNKNOWN,
+	[455] = OPCODE_INFO_UNKNOWN,
+	[456] = OPCODE_INFO_UNKNOWN,
+	[457] = OPCODE_INFO_UNKNOWN,
+	[458] = OPCODE_INFO_UNKNOWN,
+	[459] = OPCODE_INFO_UNKNOWN,
+	[460] = OPCODE_INFO_UNKNOWN,
+	[461] = OPCODE_INFO_UNKNOWN,
+	[462] = OPCODE_INFO_UNKNOWN,
+	[463] = OPCODE_INFO_UNKNOWN,
+	[464] = OPCODE_INFO_UNKNOWN,
+	[465] = OPCODE_INFO_UNKNOWN,
+	[466] = OPCODE_INFO_UNKNOWN,
+	[467] = OPCODE_INFO_UNKNOWN,
+	[468] = OPCODE_INFO_UNKNOWN,
+	[469] = OPCODE_INFO_UNKNOWN,
+	[470] = OPCODE_INFO_UNKNOWN,
+	[471] = OPCODE_INFO_UNKNOWN,
+	[472] = OPCODE_INFO_UNKNOWN,
+	[473] = OPCODE_INFO_UNKNOWN,
+	[474] = OPCODE_INFO_UNKNOWN,
+	[475] = OPCODE_INFO_UNKNOWN,
+	[476] = OPCODE_INFO_UNKNOWN,
+	[477] = OPCODE_INFO_UNKNOWN,
+	[478] = OPCODE_INFO_UNKNOWN,
+	[479] = OPCODE_INFO_UNKNOWN,
+	[480] = OPCODE_INFO_UNKNOWN,
+	[481] = OPCODE_INFO_UNKNOWN,
+	[482] = OPCODE_INFO_UNKNOWN,
+	[483] = OPCODE_INFO_UNKNOWN,
+	[484] = OPCODE_INFO_UNKNOWN,
+	[485] = OPCODE_INFO_UNKNOWN,
+	[486] = OPCODE_INFO_UNKNOWN,
+	[487] = OPCODE_INFO_UNKNOWN,
+	[488] = OPCODE_INFO_UNKNOWN,
+	[489] = OPCODE_INFO_UNKNOWN,
+	[490] = OPCODE_INFO_UNKNOWN,
+	[491] = OPCODE_INFO_UNKNOWN,
+	[492] = OPCODE_INFO_UNKNOWN,
+	[493] = OPCODE_INFO_UNKNOWN,
+	[494] = OPCODE_INFO_UNKNOWN,
+	[495] = OPCODE_INFO_UNKNOWN,
+	[496] = OPCODE_INFO_UNKNOWN,
+	[497] = OPCODE_INFO_UNKNOWN,
+	[498] = OPCODE_INFO_UNKNOWN,
+	[499] = OPCODE_INFO_UNKNOWN,
+	[500] = OPCODE_INFO_UNKNOWN,
+	[501] = OPCODE_INFO_UNKNOWN,
+	[502] = OPCODE_INFO_UNKNOWN,
+	[503] = OPCODE_INFO_UNKNOWN,
+	[504] = OPCODE_INFO_UNKNOWN,
+	[505] = OPCODE_INFO_UNKNOWN,
+	[506] = OPCODE_INFO_UNKNOWN,
+	[507] = OPCODE_INFO_UNKNOWN,
+	[508] = OPCODE_INFO_UNKNOWN,
+	[509] = OPCODE_INFO_UNKNOWN,
+	[510] = OPCODE_INFO_UNKNOWN,
+	[511] = OPCODE_INFO_UNKNOWN,
+	[512] = OPCODE_INFO_UNKNOWN,
+	[513] = OPCODE_INFO_UNKNOWN,
+	[514] = OPCODE_INFO_UNKNOWN,
+	[515] = OPCODE_INFO_UNKNOWN,
+	[516] = OPCODE_INFO_UNKNOWN,
+	[517] = OPCODE_INFO_UNKNOWN,
+	[518] = OPCODE_INFO_UNKNOWN,
+	[519] = OPCODE_INFO_UNKNOWN,
+	[520] = OPCODE_INFO_UNKNOWN,
+	[521] = OPCODE_INFO_UNKNOWN,
+	[522] = OPCODE_INFO_UNKNOWN,
+	[523] = OPCODE_INFO_UNKNOWN,
+	[524] = OPCODE_INFO_UNKNOWN,
+	[525] = OPCODE_INFO_UNKNOWN,
+	[526] = OPCODE_INFO_UNKNOWN,
+	[527] = OPCODE_INFO_UNKNOWN,
+	[528] = OPCODE_INFO_UNKNOWN,
+	[529] = OPCODE_INFO_UNKNOWN,
+	[530] = OPCODE_INFO_UNKNOWN,
+	[531] = OPCODE_INFO_UNKNOWN,
+	[532] = OPCODE_INFO_UNKNOWN,
+	[533] = OPCODE_INFO_UNKNOWN,
+	[534] = OPCODE_INFO_UNKNOWN,
+	[535] = OPCODE_INFO_UNKNOWN,
+	[536] = OPCODE_INFO_UNKNOWN,
+	[537] = OPCODE_INFO_UNKNOWN,
+	[538] = OPCODE_INFO_UNKNOWN,
+	[539] = OPCODE_INFO_UNKNOWN,
+	[540] = OPCODE_INFO_UNKNOWN,
+	[541] = OPCODE_INFO_UNKNOWN,
+	[542] = OPCODE_INFO_UNKNOWN,
+	[543] = OPCODE_INFO_UNKNOWN,
+	[544] = OPCODE_INFO_UNKNOWN,
+	[545] = OPCODE_INFO_UNKNOWN,
+	[546] = OPCODE_INFO_UNKNOWN,
+	[547] = OPCODE_INFO_UNKNOWN,
+	[548] = OPCODE_INFO_UNKNOWN,
+	[549] = OPCODE_INFO_UNKNOWN,
+	[550] = OPCODE_INFO_UNKNOWN,
+	[551] = OPCODE_INFO_UNKNOWN,
+	[552] = OPCODE_INFO_UNKNOWN,
+	[553] = OPCODE_INFO_UNKNOWN,
+	[554] = OPCODE_INFO_UNKNOWN,
+	[555] = OPCODE_INFO_UNKNOWN,
+	[556] = OPCODE_INFO_UNKNOWN,
+	[557] = OPCODE_INFO_UNKNOWN,
+	[558] = OPCODE_INFO_UNKNOWN,
+	[559] = OPCODE_INFO_UNKNOWN,
+	[560] = OPCODE_INFO_UNKNOWN,
+	[561] = OPCODE_INFO_UNKNOWN,
+	[562] = OPCODE_INFO_UNKNOWN,
+	[563] = OPCODE_INFO_UNKNOWN,
+	[564] = OPCODE_INFO_UNKNOWN,
+	[565] = OPCODE_INFO_UNKNOWN,
+	[566] = OPCODE_INFO_UNKNOWN,
+	[567] = OPCODE_INFO_UNKNOWN,
+	[568] = OPCODE_INFO_UNKNOWN,
+	[569] = OPCODE_INFO_UNKNOWN,
+	[570] = OPCODE_INFO_UNKNOWN,
+	[571] = OPCODE_INFO_UNKNOWN,
+	[572] = OPCODE_INFO_UNKNOWN,
+	[573] = OPCODE_INFO_UNKNOWN,
+	[574] = OPCODE_INFO_UNKNOWN,
+	[575] = OPCODE_INFO_UNKNOWN,
+	[576] = OPCODE_INFO_UNKNOWN,
+	[577] = OPCODE_INFO_UNKNOWN,
+	[578] = OPCODE_INFO_UNKNOWN,
+	[579] = OPCODE_INFO_UNKNOWN,
+	[580] = OPCODE_INFO_UNKNOWN,
+	[581] = OPCODE_INFO_UNKNOWN,
+	[582] = OPCODE_INFO_UNKNOWN,
+	[583] = OPCODE_INFO_UNKNOWN,
+	[584] = OPCODE_INFO_UNKNOWN,
+	[585] = OPCODE_INFO_UNKNOWN,
+	[586] = OPCODE_INFO_UNKNOWN,
+	[587] = OPCODE_INFO_UNKNOWN,
+	[588] = OPCODE_INFO_UNKNOWN,
+	[589] = OPCODE_INFO_UNKNOWN,
+	[590] = OPCODE_INFO_UNKNOWN,
+	[591] = OPCODE_INFO_UNKNOWN,
+	[592] = OPCODE_INFO_UNKNOWN,
+	[593] = OPCODE_INFO_UNKNOWN,
+	[594] = OPCODE_INFO_UNKNOWN,
+	[595] = OPCODE_INFO_UNKNOWN,
+	[596] = OPCODE_INFO_UNKNOWN,
+	[597] = OPCODE_INFO_UNKNOWN,
+	[598] = OPCODE_INFO_UNKNOWN,
+	[599] = OPCODE_INFO_UNKNOWN,
+	[600] = OPCODE_INFO_UNKNOWN,
+	[601] = OPCODE_INFO_UNKNOWN,
+	[602] = OPCODE_INFO_UNKNOWN,
+	[603] = OPCODE_INFO_UNKNOWN,
+	[604] = OPCODE_INFO_UNKNOWN,
+	[605] = OPCODE_INFO_UNKNOWN,
+	[606] = OPCODE_INFO_UNKNOWN,
+	[607] = OPCODE_INFO_UNKNOWN,
+	[608] = OPCODE_INFO_UNKNOWN,
+	[609] = OPCODE_INFO_UNKNOWN,
+	[610] = OPCODE_INFO_UNKNOWN,
+	[611] = OPCODE_INFO_UNKNOWN,
+	[612] = OPCODE_INFO_UNKNOWN,
+	[613] = OPCODE_INFO_UNKNOWN,
+	[614] = OPCODE_INFO_UNKNOWN,
+	[615] = OPCODE_INFO_UNKNOWN,
+	[616] = OPCODE_INFO_UNKNOWN,
+	[617] = OPCODE_INFO_UNKNOWN,
+	[618] = OPCODE_INFO_UNKNOWN,
+	[619] = OPCODE_INFO_UNKNOWN,
+	[620] = OPCODE_INFO_UNKNOWN,
+	[621] = OPCODE_INFO_UNKNOWN,
+	[622] = OPCODE_INFO_UNKNOWN,
+	[623] = OPCODE_INFO_UNKNOWN,
+	[624] = OPCODE_INFO_UNKNOWN,
+	[625] = OPCODE_INFO_UNKNOWN,
+	[626] = OPCODE_INFO_UNKNOWN,
+	[627] = OPCODE_INFO_UNKNOWN,
+	[628] = OPCODE_INFO_UNKNOWN,
+	[629] = OPCODE_INFO_UNKNOWN,
+	[630] = OPCODE_INFO_UNKNOWN,
+	[631] = OPCODE_INFO_UNKNOWN,
+	[632] = OPCODE_INFO_UNKNOWN,
+	[633] = OPCODE_INFO_UNKNOWN,
+	[634] = OPCODE_INFO_UNKNOWN,
+	[635] = OPCODE_INFO_UNKNOWN,
+	[636] = OPCODE_INFO_UNKNOWN,
+	[637] = OPCODE_INFO_UNKNOWN,
+	[638] = OPCODE_INFO_UNKNOWN,
+	[639] = OPCODE_INFO_UNKNOWN,
+	[640] = OPCODE_INFO_UNKNOWN,
+	[641] = OPCODE_INFO_UNKNOWN,
+	[642] = OPCODE_INFO_UNKNOWN,
+	[643] = OPCODE_INFO_UNKNOWN,
+	[644] = OPCODE_INFO_UNKNOWN,
+	[645] = OPCODE_INFO_UNKNOWN,
+	[646] = OPCODE_INFO_UNKNOWN,
+	[647] = OPCODE_INFO_UNKNOWN,
+	[648] = OPCODE_INFO_UNKNOWN,
+	[649] = OPCODE_INFO_UNKNOWN,
+	[650] = OPCODE_INFO_UNKNOWN,
+	[651] = OPCODE_INFO_UNKNOWN,
+	[652] = OPCODE_INFO_UNKNOWN,
+	[653] = OPCODE_INFO_UNKNOWN,
+	[654] = OPCODE_INFO_UNKNOWN,
+	[655] = OPCODE_INFO_UNKNOWN,
+	[656] = OPCODE_INFO_UNKNOWN,
+	[657] = OPCODE_INFO_UNKNOWN,
+	[658] = OPCODE_INFO_UNKNOWN,
+	[659] = OPCODE_INFO_UNKNOWN,
+	[660] = OPCODE_INFO_UNKNOWN,
+	[661] = OPCODE_INFO_UNKNOWN,
+	[662] = OPCODE_INFO_UNKNOWN,
+	[663] = OPCODE_INFO_UNKNOWN,
+	[664] = OPCODE_INFO_UNKNOWN,
+	[665] = OPCODE_INFO_UNKNOWN,
+	[666] = OPCODE_INFO_UNKNOWN,
+	[667] = OPCODE_INFO_UNKNOWN,
+	[668] = OPCODE_INFO_UNKNOWN,
+	[669] = OPCODE_INFO_UNKNOWN,
+	[670] = OPCODE_INFO_UNKNOWN,
+	[671] = OPCODE_INFO_UNKNOWN,
+	[672] = OPCODE_INFO_UNKNOWN,
+	[673] = OPCODE_INFO_UNKNOWN,
+	[674] = OPCODE_INFO_UNKNOWN,
+	[675] = OPCODE_INFO_UNKNOWN,
+	[676] = OPCODE_INFO_UNKNOWN,
+	[677] = OPCODE_INFO_UNKNOWN,
+	[678] = OPCODE_INFO_UNKNOWN,
+	[679] = OPCODE_INFO_UNKNOWN,
+	[680] = OPCODE_INFO_UNKNOWN,
+	[681] = OPCODE_INFO_UNKNOWN,
+	[682] = OPCODE_INFO_UNKNOWN,
+	[683] = OPCODE_INFO_UNKNOWN,
+	[684] = OPCODE_INFO_UNKNOWN,
+	[685] = OPCODE_INFO_UNKNOWN,
+	[686] = OPCODE_INFO_UNKNOWN,
+	[687] = OPCODE_INFO_UNKNOWN,
+	[688] = OPCODE_INFO_UNKNOWN,
+	[689] = OPCODE_INFO_UNKNOWN,
+	[690] = OPCODE_INFO_UNKNOWN,
+	[691] = OPCODE_INFO_UNKNOWN,
+	[692] = OPCODE_INFO_UNKNOWN,
+	[693] = OPCODE_INFO_UNKNOWN,
+	[694] = OPCODE_INFO_UNKNOWN,
+	[695] = OPCODE_INFO_UNKNOWN,
+	[696] = OPCODE_INFO_UNKNOWN,
+	[697] = OPCODE_INFO_UNKNOWN,
+	[698] = OPCODE_INFO_UNKNOWN,
+	[699] = OPCODE_INFO_UNKNOWN,
+	[700] = OPCODE_INFO_UNKNOWN,
+	[701] = OPCODE_INFO_UNKNOWN,
+	[702] = OPCODE_INFO_UNKNOWN,
+	[703] = OPCODE_INFO_UNKNOWN,
+	[704] = OPCODE_INFO_UNKNOWN,
+	[705] = OPCODE_INFO_UNKNOWN,
+	[706] = OPCODE_INFO_UNKNOWN,
+	[707] = OPCODE_INFO_UNKNOWN,
+	[708] = OPCODE_INFO_UNKNOWN,
+	[709] = OPCODE_INFO_UNKNOWN,
+	[710] = OPCODE_INFO_UNKNOWN,
+	[711] = OPCODE_INFO_UNKNOWN,
+	[712] = OPCODE_INFO_UNKNOWN,
+	[713] = OPCODE_INFO_UNKNOWN,
+	[714] = OPCODE_INFO_UNKNOWN,
+	[715] = OPCODE_INFO_UNKNOWN,
+	[716] = OPCODE_INFO_UNKNOWN,
+	[717] = OPCODE_INFO_UNKNOWN,
+	[718] = OPCODE_INFO_UNKNOWN,
+	[719] = OPCODE_INFO_UNKNOWN,
+	[720] = OPCODE_INFO_UNKNOWN,
+	[721] = OPCODE_INFO_UNKNOWN,
+	[722] = OPCODE_INFO_UNKNOWN,
+	[723] = OPCODE_INFO_UNKNOWN,
+	[724] = OPCODE_INFO_UNKNOWN,
+	[725] = OPCODE_INFO_UNKNOWN,
+	[726] = OPCODE_INFO_UNKNOWN,
+	[727] = OPCODE_INFO_UNKNOWN,
+	[728] = OPCODE_INFO_UNKNOWN,
+	[729] = OPCODE_INFO_UNKNOWN,
+	[730] = OPCODE_INFO_UNKNOWN,
+	[731] = OPCODE_INFO_UNKNOWN,
+	[732] = OPCODE_INFO_UNKNOWN,
+	[733] = OPCODE_INFO_UNKNOWN,
+	[734] = OPCODE_INFO_UNKNOWN,
+	[735] = OPCODE_INFO_UNKNOWN,
+	[736] = OPCODE_INFO_UNKNOWN,
+	[737] = OPCODE_INFO_UNKNOWN,
+	[738] = OPCODE_INFO_UNKNOWN,
+	[739] = OPCODE_INFO_UNKNOWN,
+	[740] = OPCODE_INFO_UNKNOWN,
+	[741] = OPCODE_INFO_UNKNOWN,
+	[742] = OPCODE_INFO_UNKNOWN,
+	[743] = OPCODE_INFO_UNKNOWN,
+	[744] = OPCODE_INFO_UNKNOWN,
+	[745] = OPCODE_INFO_UNKNOWN,
+	[746] = OPCODE_INFO_UNKNOWN,
+	[747] = OPCODE_INFO_UNKNOWN,
+	[748] = OPCODE_INFO_UNKNOWN,
+	[749] = OPCODE_INFO_UNKNOWN,
+	[750] = OPCODE_INFO_UNKNOWN,
+	[751] = OPCODE_INFO_UNKNOWN,
+	[752] = OPCODE_INFO_UNKNOWN,
+	[753] = OPCODE_INFO_UNKNOWN,
+	[754] = OPCODE_INFO_UNKNOWN,
+	[755] = OPCODE_INFO_UNKNOWN,
+	[756] = OPCODE_INFO_UNKNOWN,
+	[757] = OPCODE_INFO_UNKNOWN,
+	[758] = OPCODE_INFO_UNKNOWN,
+	[759] = OPCODE_INFO_UNKNOWN,
+	[760] = OPCODE_INFO_UNKNOWN,
+	[761] = OPCODE_INFO_UNKNOWN,
+	[762] = OPCODE_INFO_UNKNOWN,
+	[763] = OPCODE_INFO_UNKNOWN,
+	[764] = OPCODE_INFO_UNKNOWN,
+	[765] = OPCODE_INFO_UNKNOWN,
+	[766] = OPCODE_INFO_UNKNOWN,
+	[767] = OPCODE_INFO_UNKNOWN,
+	[768] = OPCODE_INFO_UNKNOWN,
+	[769] = OPCODE_INFO_UNKNOWN,
+	[770] = OPCODE_INFO_UNKNOWN,
+	[771] = OPCODE_INFO_UNKNOWN,
+	[772] = OPCODE_INFO_UNKNOWN,
+	[773] = OPCODE_INFO_UNKNOWN,
+	[774] = OPCODE_INFO_UNKNOWN,
+	[775] = OPCODE_INFO_UNKNOWN,
+	[776] = OPCODE_INFO_UNKNOWN,
+	[777] = OPCODE_INFO_UNKNOWN,
+	[778] = OPCODE_INFO_UNKNOWN,
+	[779] = OPCODE_INFO_UNKNOWN,
+	[780] = OPCODE_INFO_UNKNOWN,
+	[781] = OPCODE_INFO_UNKNOWN,
+	[782] = OPCODE_INFO_UNKNOWN,
+	[783] = OPCODE_INFO_UNKNOWN,
+	[784] = OPCODE_INFO_UNKNOWN,
+	[785] = OPCODE_INFO_UNKNOWN,
+	[786] = OPCODE_INFO_UNKNOWN,
+	[787] = OPCODE_INFO_UNKNOWN,
+	[788] = OPCODE_INFO_UNKNOWN,
+	[789] = OPCODE_INFO_UNKNOWN,
+	[790] = OPCODE_INFO_UNKNOWN,
+	[791] = OPCODE_INFO_UNKNOWN,
+	[792] = OPCODE_INFO_UNKNOWN,
+	[793] = OPCODE_INFO_UNKNOWN,
+	[794] = OPCODE_INFO_UNKNOWN,
+	[795] = OPCODE_INFO_UNKNOWN,
+	[796] = OPCODE_INFO_UNKNOWN,
+	[797] = OPCODE_INFO_UNKNOWN,
+	[798] = OPCODE_INFO_UNKNOWN,
+	[799] = OPCODE_INFO_UNKNOWN,
+	[800] = OPCODE_INFO_UNKNOWN,
+	[801] = OPCODE_INFO_UNKNOWN,
+	[802] = OPCODE_INFO_UNKNOWN,
+	[803] = OPCODE_INFO_UNKNOWN,
+	[804] = OPCODE_INFO_UNKNOWN,
+	[805] = OPCODE_INFO_UNKNOWN,
+	[806] = OPCODE_INFO_UNKNOWN,
+	[807] = OPCODE_INFO_UNKNOWN,
+	[808] = OPCODE_INFO_UNKNOWN,
+	[809] = OPCODE_INFO_UNKNOWN,
+	[810] = OPCODE_INFO_UNKNOWN,
+	[811] = OPCODE_INFO_UNKNOWN,
+	[812] = OPCODE_INFO_UNKNOWN,
+	[813] = OPCODE_INFO_UNKNOWN,
+	[814] = OPCODE_INFO_UNKNOWN,
+	[815] = OPCODE_INFO_UNKNOWN,
+	[816] = OPCODE_INFO_UNKNOWN,
+	[817] = OPCODE_INFO_UNKNOWN,
+	[818] = OPCODE_INFO_UNKNOWN,
+	[819] = OPCODE_INFO_UNKNOWN,
+	[820] = OPCODE_INFO_UNKNOWN,
+	[821] = OPCODE_INFO_UNKNOWN,
+	[822] = OPCODE_INFO_UNKNOWN,
+	[823] = OPCODE_INFO_UNKNOWN,
+	[824] = OPCODE_INFO_UNKNOWN,
+	[825] = OPCODE_INFO_UNKNOWN,
+	[826] = OPCODE_INFO_UNKNOWN,
+	[827] = OPCODE_INFO_UNKNOWN,
+	[828] = OPCODE_INFO_UNKNOWN,
+	[829] = OPCODE_INFO_UNKNOWN,
+	[830] = OPCODE_INFO_UNKNOWN,
+	[831] = OPCODE_INFO_UNKNOWN,
+	[832] = OPCODE_INFO_UNKNOWN,
+	[833] = OPCODE_INFO_UNKNOWN,
+	[834] = OPCODE_INFO_UNKNOWN,
+	[835] = OPCODE_INFO_UNKNOWN,
+	[836] = OPCODE_INFO_UNKNOWN,
+	[837] = OPCODE_INFO_UNKNOWN,
+	[838] = OPCODE_INFO_UNKNOWN,
+	[839] = OPCODE_INFO_UNKNOWN,
+	[840] = OPCODE_INFO_UNKNOWN,
+	[841] = OPCODE_INFO_UNKNOWN,
+	[842] = OPCODE_INFO_UNKNOWN,
+	[843] = OPCODE_INFO_UNKNOWN,
+	[844] = OPCODE_INFO_UNKNOWN,
+	[845] = OPCODE_INFO_UNKNOWN,
+	[846] = OPCODE_INFO_UNKNOWN,
+	[847] = OPCODE_INFO_UNKNOWN,
+	[848] = OPCODE_INFO_UNKNOWN,
+	[849] = OPCODE_INFO_UNKNOWN,
+	[850] = OPCODE_INFO_UNKNOWN,
+	[851] = OPCODE_INFO_UNKNOWN,
+	[852] = OPCODE_INFO_UNKNOWN,
+	[853] = OPCODE_INFO_UNKNOWN,
+	[854] = OPCODE_INFO_UNKNOWN,
+	[855] = OPCODE_INFO_UNKNOWN,
+	[856] = OPCODE_INFO_UNKNOWN,
+	[857] = OPCODE_INFO_UNKNOWN,
+	[858] = OPCODE_INFO_UNKNOWN,
+	[859] = OPCODE_INFO_UNKNOWN,
+	[860] = OPCODE_INFO_UNKNOWN,
+	[861] = OPCODE_INFO_UNKNOWN,
+	[862] = OPCODE_INFO_UNKNOWN,
+	[863] = OPCODE_INFO_UNKNOWN,
+	[864] = OPCODE_INFO_UNKNOWN,
+	[865] = OPCODE_INFO_UNKNOWN,
+	[866] = OPCODE_INFO_UNKNOWN,
+	[867] = OPCODE_INFO_UNKNOWN,
+	[868] = OPCODE_INFO_UNKNOWN,
+	[869] = OPCODE_INFO_UNKNOWN,
+	[870] = OPCODE_INFO_UNKNOWN,
+	[871] = OPCODE_INFO_UNKNOWN,
+	[872] = OPCODE_INFO_UNKNOWN,
+	[873] = OPCODE_INFO_UNKNOWN,
+	[874] = OPCODE_INFO_UNKNOWN,
+	[875] = OPCODE_INFO_UNKNOWN,
+	[876] = OPCODE_INFO_UNKNOWN,
+	[877] = OPCODE_INFO_UNKNOWN,
+	[878] = OPCODE_INFO_UNKNOWN,
+	[879] = OPCODE_INFO_UNKNOWN,
+	[880] = OPCODE_INFO_UNKNOWN,
+	[881] = OPCODE_INFO_UNKNOWN,
+	[882] = OPCODE_INFO_UNKNOWN,
+	[883] = OPCODE_INFO_UNKNOWN,
+	[884] = OPCODE_INFO_UNKNOWN,
+	[885] = OPCODE_INFO_UNKNOWN,
+	[886] = OPCODE_INFO_UNKNOWN,
+	[887] = OPCODE_INFO_UNKNOWN,
+	[888] = OPCODE_INFO_UNKNOWN,
+	[889] = OPCODE_INFO_UNKNOWN,
+	[890] = OPCODE_INFO_UNKNOWN,
+	[891] = OPCODE_INFO_UNKNOWN,
+	[892] = OPCODE_INFO_UNKNOWN,
+	[893] = OPCODE_INFO_UNKNOWN,
+	[894] = OPCODE_INFO_UNKNOWN,
+	[895] = OPCODE_INFO_UNKNOWN,
+	[896] = OPCODE_INFO_UNKNOWN,
+	[897] = OPCODE_INFO_UNKNOWN,
+	[898] = OPCODE_INFO_UNKNOWN,
+	[899] = OPCODE_INFO_UNKNOWN,
+	[900] = OPCODE_INFO_UNKNOWN,
+	[901] = OPCODE_INFO_UNKNOWN,
+	[902] = OPCODE_INFO_UNKNOWN,
+	[903] = OPCODE_INFO_UNKNOWN,
+	[904] = OPCODE_INFO_UNKNOWN,
+	[905] = OPCODE_INFO_UNKNOWN,
+	[906] = OPCODE_INFO_UNKNOWN,
+	[907] = OPCODE_INFO_UNKNOWN,
+	[908] = OPCODE_INFO_UNKNOWN,
+	[909] = OPCODE_INFO_UNKNOWN,
+	[910] = OPCODE_INFO_UNKNOWN,
+	[911] = OPCODE_INFO_UNKNOWN,
+	[912] = OPCODE_INFO_UNKNOWN,
+	[913] = OPCODE_INFO_UNKNOWN,
+	[914] = OPCODE_INFO_UNKNOWN,
+	[915] = OPCODE_INFO_UNKNOWN,
+	[916] = OPCODE_INFO_UNKNOWN,
+	[917] = OPCODE_INFO_UNKNOWN,
+	[918] = OPCODE_INFO_UNKNOWN,
+	[919] = OPCODE_INFO_UNKNOWN,
+	[920] = OPCODE_INFO_UNKNOWN,
+	[921] = OPCODE_INFO_UNKNOWN,
+	[922] = OPCODE_INFO_UNKNOWN,
+	[923] = OPCODE_INFO_UNKNOWN,
+	[924] = OPCODE_INFO_UNKNOWN,
+	[925] = OPCODE_INFO_UNKNOWN,
+	[926] = OPCODE_INFO_UNKNOWN,
+	[927] = OPCODE_INFO_UNKNOWN,
+	[928] = OPCODE_INFO_UNKNOWN,
+	[929] = OPCODE_INFO_UNKNOWN,
+	[930] = OPCODE_INFO_UNKNOWN,
+	[931] = OPCODE_INFO_UNKNOWN,
+	[932] = OPCODE_INFO_UNKNOWN,
+	[933] = OPCODE_INFO_UNKNOWN,
+	[934] = OPCODE_INFO_UNKNOWN,
+	[935] = OPCODE_INFO_UNKNOWN,
+	[936] = OPCODE_INFO_UNKNOWN,
+	[937] = OPCODE_INFO_UNKNOWN,
+	[938] = OPCODE_INFO_UNKNOWN,
+	[939] = OPCODE_INFO_UNKNOWN,
+	[940] = OPCODE_INFO_UNKNOWN,
+	[941] = OPCODE_INFO_UNKNOWN,
+	[942] = OPCODE_INFO_UNKNOWN,
+	[943] = OPCODE_INFO_UNKNOWN,
+	[944] = OPCODE_INFO_UNKNOWN,
+	[945] = OPCODE_INFO_UNKNOWN,
+	[946] = OPCODE_INFO_UNKNOWN,
+	[947] = OPCODE_INFO_UNKNOWN,
+	[948] = OPCODE_INFO_UNKNOWN,
+	[949] = OPCODE_INFO_UNKNOWN,
+	[950] = OPCODE_INFO_UNKNOWN,
+	[951] = OPCODE_INFO_UNKNOWN,
+	[952] = OPCODE_INFO_UNKNOWN,
+	[953] = OPCODE_INFO_UNKNOWN,
+	[954] = OPCODE_INFO_UNKNOWN,
+	[955] = OPCODE_INFO_UNKNOWN,
+	[956] = OPCODE_INFO_UNKNOWN,
+	[957] = OPCODE_INFO_UNKNOWN,
+	[958] = OPCODE_INFO_UNKNOWN,
+	[959] = OPCODE_INFO_UNKNOWN,
+	[960] = OPCODE_INFO_UNKNOWN,
+	[961] = OPCODE_INFO_UNKNOWN,
+	[962] = OPCODE_INFO_UNKNOWN,
+	[963] = OPCODE_INFO_UNKNOWN,
+	[964] = OPCODE_INFO_UNKNOWN,
+	[965] = OPCODE_INFO_UNKNOWN,
+	[966] = OPCODE_INFO_UNKNOWN,
+	[967] = OPCODE_INFO_UNKNOWN,
+	[968] = OPCODE_INFO_UNKNOWN,
+	[969] = OPCODE_INFO_UNKNOWN,
+	[970] = OPCODE_INFO_UNKNOWN,
+	[971] = OPCODE_INFO_UNKNOWN,
+	[972] = OPCODE_INFO_UNKNOWN,
+	[973] = OPCODE_INFO_UNKNOWN,
+	[974] = OPCODE_INFO_UNKNOWN,
+	[975] = OPCODE_INFO_UNKNOWN,
+	[976] = OPCODE_INFO_UNKNOWN,
+	[977] = OPCODE_INFO_UNKNOWN,
+	[978] = OPCODE_INFO_UNKNOWN,
+	[979] = OPCODE_INFO_UNKNOWN,
+	[980] = OPCODE_INFO_UNKNOWN,
+	[981] = OPCODE_INFO_UNKNOWN,
+	[982] = OPCODE_INFO_UNKNOWN,
+	[983] = OPCODE_INFO_UNKNOWN,
+	[984] = OPCODE_INFO_UNKNOWN,
+	[985] = OPCODE_INFO_UNKNOWN,
+	[986] = OPCODE_INFO_UNKNOWN,
+	[987] = OPCODE_INFO_UNKNOWN,
+	[988] = OPCODE_INFO_UNKNOWN,
+	[989] = OPCODE_INFO_UNKNOWN,
+	[990] = OPCODE_INFO_UNKNOWN,
+	[991] = OPCODE_INFO_UNKNOWN,
+	[992] = OPCODE_INFO_UNKNOWN,
+	[993] = OPCODE_INFO_UNKNOWN,
+	[994] = OPCODE_INFO_UNKNOWN,
+	[995] = OPCODE_INFO_UNKNOWN,
+	[996] = OPCODE_INFO_UNKNOWN,
+	[997] = OPCODE_INFO_UNKNOWN,
+	[998] = OPCODE_INFO_UNKNOWN,
+	[999] = OPCODE_INFO_UNKNOWN,
+	[1000] = OPCODE_INFO_UNKNOWN,
+	[1001] = OPCODE_INFO_UNKNOWN,
+	[1002] = OPCODE_INFO_UNKNOWN,
+	[1003] = OPCODE_INFO_UNKNOWN,
+	[1004] = OPCODE_INFO_UNKNOWN,
+	[1005] = OPCODE_INFO_UNKNOWN,
+	[1006] = OPCODE_INFO_UNKNOWN,
+	[1007] = OPCODE_INFO_UNKNOWN,
+	[1008] = OPCODE_INFO_UNKNOWN,
+	[1009] = OPCODE_INFO_UNKNOWN,
+	[1010] = OPCODE_INFO_UNKNOWN,
+	[1011] = OPCODE_INFO_UNKNOWN,
+	[1012] = OPCODE_INFO_UNKNOWN,
+	[1013] = OPCODE_INFO_UNKNOWN,
+	[1014] = OPCODE_INFO_UNKNOWN,
+	[1015] = OPCODE_INFO_UNKNOWN,
+	[1016] = OPCODE_INFO_UNKNOWN,
+	[1017] = OPCODE_INFO_UNKNOWN,
+	[1018] = OPCODE_INFO_UNKNOWN,
+	[1019] = OPCODE_INFO_UNKNOWN,
+	[1020] = OPCODE_INFO_UNKNOWN,
+	[1021] = OPCODE_INFO_UNKNOWN,
+	[1022] = OPCODE_INFO_UNKNOWN,
+	[1023] = OPCODE_INFO_UNKNOWN,
+	[1024] = OPCODE_INFO_UNKNOWN,
+	[1025] = OPCODE_INFO_UNKNOWN,
+	[1026] = OPCODE_INFO_UNKNOWN,
+	[1027] = OPCODE_INFO_UNKNOWN,
+	[1028] = OPCODE_INFO_UNKNOWN,
+	[1029] = OPCODE_INFO_UNKNOWN,
+	[1030] = OPCODE_INFO_UNKNOWN,
+	[1031] = OPCODE_INFO_UNKNOWN,
+	[1032] = OPCODE_INFO_UNKNOWN,
+	[1033] = OPCODE_INFO_UNKNOWN,
+	[1034] = OPCODE_INFO_UNKNOWN,
+	[1035] = OPCODE_INFO_UNKNOWN,
+	[1036] = OPCODE_INFO_UNKNOWN,
+	[1037] = OPCODE_INFO_UNKNOWN,
+	[1038] = OPCODE_INFO_UNKNOWN,
+	[1039] = OPCODE_INFO_UNKNOWN,
+	[1040] = OPCODE_INFO_UNKNOWN,
+	[1041] = OPCODE_INFO_UNKNOWN,
+	[1042] = OPCODE_INFO_UNKNOWN,
+	[1043] = OPCODE_INFO_UNKNOWN,
+	[1044] = OPCODE_INFO_UNKNOWN,
+	[1045] = OPCODE_INFO_UNKNOWN,
+	[1046] = OPCODE_INFO_UNKNOWN,
+	[1047] = OPCODE_INFO_UNKNOWN,
+	[1048] = OPCODE_INFO_UNKNOWN,
+	[1049] = OPCODE_INFO_UNKNOWN,
+	[1050] = OPCODE_INFO_UNKNOWN,
+	[1051] = OPCODE_INFO_UNKNOWN,
+	[1052] = OPCODE_INFO_UNKNOWN,
+	[1053] = OPCODE_INFO_UNKNOWN,
+	[1054] = OPCODE_INFO_UNKNOWN,
+	[1055] = OPCODE_INFO_UNKNOWN,
+	[1056] = OPCODE_INFO_UNKNOWN,
+	[1057] = OPCODE_INFO_UNKNOWN,
+	[1058] = OPCODE_INFO_UNKNOWN,
+	[1059] = OPCODE_INFO_UNKNOWN,
+	[1060] = OPCODE_INFO_UNKNOWN,
+	[1061] = OPCODE_INFO_UNKNOWN,
+	[1062] = OPCODE_INFO_UNKNOWN,
+	[1063] = OPCODE_INFO_UNKNOWN,
+	[1064] = OPCODE_INFO_UNKNOWN,
+	[1065] = OPCODE_INFO_UNKNOWN,
+	[1066] = OPCODE_INFO_UNKNOWN,
+	[1067] = OPCODE_INFO_UNKNOWN,
+	[1068] = OPCODE_INFO_UNKNOWN,
+	[1069] = OPCODE_INFO_UNKNOWN,
+	[1070] = OPCODE_INFO_UNKNOWN,
+	[1071] = OPCODE_INFO_UNKNOWN,
+	[1072] = OPCODE_INFO_UNKNOWN,
+	[1073] = OPCODE_INFO_UNKNOWN,
+	[1074] = OPCODE_INFO_UNKNOWN,
+	[1075] = OPCODE_INFO_UNKNOWN,
+	[1076] = OPCODE_INFO_UNKNOWN,
+	[1077] = OPCODE_INFO_UNKNOWN,
+	[1078] = OPCODE_INFO_UNKNOWN,
+	[1079] = OPCODE_INFO_UNKNOWN,
+	[1080] = OPCODE_INFO_UNKNOWN,
+	[1081] = OPCODE_INFO_UNKNOWN,
+	[1082] = OPCODE_INFO_UNKNOWN,
+	[1083] = OPCODE_INFO_UNKNOWN,
+	[1084] = OPCODE_INFO_UNKNOWN,
+	[1085] = OPCODE_INFO_UNKNOWN,
+	[1086] = OPCODE_INFO_UNKNOWN,
+	[1087] = OPCODE_INFO_UNKNOWN,
+	[1088] = OPCODE_INFO_UNKNOWN,
+	[1089] = OPCODE_INFO_UNKNOWN,
+	[1090] = OPCODE_INFO_UNKNOWN,
+	[1091] = OPCODE_INFO_UNKNOWN,
+	[1092] = OPCODE_INFO_UNKNOWN,
+	[1093] = OPCODE_INFO_UNKNOWN,
+	[1094] = OPCODE_INFO_UNKNOWN,
+	[1095] = OPCODE_INFO_UNKNOWN,
+	[1096] = OPCODE_INFO_UNKNOWN,
+	[1097] = OPCODE_INFO_UNKNOWN,
+	[1098] = OPCODE_INFO_UNKNOWN,
+	[1099] = OPCODE_INFO_UNKNOWN,
+	[1100] = OPCODE_INFO_UNKNOWN,
+	[1101] = OPCODE_INFO_UNKNOWN,
+	[1102] = OPCODE_INFO_UNKNOWN,
+	[1103] = OPCODE_INFO_UNKNOWN,
+	[1104] = OPCODE_INFO_UNKNOWN,
+	[1105] = OPCODE_INFO_UNKNOWN,
+	[1106] = OPCODE_INFO_UNKNOWN,
+	[1107] = OPCODE_INFO_UNKNOWN,
+	[1108] = OPCODE_INFO_UNKNOWN,
+	[1109] = OPCODE_INFO_UNKNOWN,
+	[1110] = OPCODE_INFO_UNKNOWN,
+	[1111] = OPCODE_INFO_UNKNOWN,
+	[1112] = OPCODE_INFO_UNKNOWN,
+	[1113] = OPCODE_INFO_UNKNOWN,
+	[1114] = OPCODE_INFO_UNKNOWN,
+	[1115] = OPCODE_INFO_UNKNOWN,
+	[1116] = OPCODE_INFO_UNKNOWN,
+	[1117] = OPCODE_INFO_UNKNOWN,
+	[1118] = OPCODE_INFO_UNKNOWN,
+	[1119] = OPCODE_INFO_UNKNOWN,
+	[1120] = OPCODE_INFO_UNKNOWN,
+	[1121] = OPCODE_INFO_UNKNOWN,
+	[1122] = OPCODE_INFO_UNKNOWN,
+	[1123] = OPCODE_INFO_UNKNOWN,
+	[1124] = OPCODE_INFO_UNKNOWN,
+	[1125] = OPCODE_INFO_UNKNOWN,
+	[1126] = OPCODE_INFO_UNKNOWN,
+	[1127] = OPCODE_INFO_UNKNOWN,
+	[1128] = OPCODE_INFO_UNKNOWN,
+	[1129] = OPCODE_INFO_UNKNOWN,
+	[1130] = OPCODE_INFO_UNKNOWN,
+	[1131] = OPCODE_INFO_UNKNOWN,
+	[1132] = OPCODE_INFO_UNKNOWN,
+	[1133] = OPCODE_INFO_UNKNOWN,
+	[1134] = OPCODE_INFO_UNKNOWN,
+	[1135] = OPCODE_INFO_UNKNOWN,
+	[1136] = OPCODE_INFO_UNKNOWN,
+	[1137] = OPCODE_INFO_UNKNOWN,
+	[1138] = OPCODE_INFO_UNKNOWN,
+	[1139] = OPCODE_INFO_UNKNOWN,
+	[1140] = OPCODE_INFO_UNKNOWN,
+	[1141] = OPCODE_INFO_UNKNOWN,
+	[1142] = OPCODE_INFO_UNKNOWN,
+	[1143] = OPCODE_INFO_UNKNOWN,
+	[1144] = OPCODE_INFO_UNKNOWN,
+	[1145] = OPCODE_INFO_UNKNOWN,
+	[1146] = OPCODE_INFO_UNKNOWN,
+	[1147] = OPCODE_INFO_UNKNOWN,
+	[1148] = OPCODE_INFO_UNKNOWN,
+	[1149] = OPCODE_INFO_UNKNOWN,
+	[1150] = OPCODE_INFO_UNKNOWN,
+	[1151] = OPCODE_INFO_UNKNOWN,
+	[1152] = OPCODE_INFO_UNKNOWN,
+	[1153] = OPCODE_INFO_UNKNOWN,
+	[1154] = OPCODE_INFO_UNKNOWN,
+	[1155] = OPCODE_INFO_UNKNOWN,
+	[1156] = OPCODE_INFO_UNKNOWN,
+	[1157] = OPCODE_INFO_UNKNOWN,
+	[1158] = OPCODE_INFO_UNKNOWN,
+	[1159] = OPCODE_INFO_UNKNOWN,
+	[1160] = OPCODE_INFO_UNKNOWN,
+	[1161] = OPCODE_INFO_UNKNOWN,
+	[1162] = OPCODE_INFO_UNKNOWN,
+	[1163] = OPCODE_INFO_UNKNOWN,
+	[1164] = OPCODE_INFO_UNKNOWN,
+	[1165] = OPCODE_INFO_UNKNOWN,
+	[1166] = OPCODE_INFO_UNKNOWN,
+	[1167] = OPCODE_INFO_UNKNOWN,
+	[1168] = OPCODE_INFO_UNKNOWN,
+	[1169] = OPCODE_INFO_UNKNOWN,
+	[1170] = OPCODE_INFO_UNKNOWN,
+	[1171] = OPCODE_INFO_UNKNOWN,
+	[1172] = OPCODE_INFO_UNKNOWN,
+	[1173] = OPCODE_INFO_UNKNOWN,
+	[1174] = OPCODE_INFO_UNKNOWN,
+	[1175] = OPCODE_INFO_UNKNOWN,
+	[1176] = OPCODE_INFO_UNKNOWN,
+	[1177] = OPCODE_INFO_UNKNOWN,
+	[1178] = OPCODE_INFO_UNKNOWN,
+	[1179] = OPCODE_INFO_UNKNOWN,
+	[1180] = OPCODE_INFO_UNKNOWN,
+	[1181] = OPCODE_INFO_UNKNOWN,
+	[1182] = OPCODE_INFO_UNKNOWN,
+	[1183] = OPCODE_INFO_UNKNOWN,
+	[1184] = OPCODE_INFO_UNKNOWN,
+	[1185] = OPCODE_INFO_UNKNOWN,
+	[1186] = OPCODE_INFO_UNKNOWN,
+	[1187] = OPCODE_INFO_UNKNOWN,
+	[1188] = OPCODE_INFO_UNKNOWN,
+	[1189] = OPCODE_INFO_UNKNOWN,
+	[1190] = OPCODE_INFO_UNKNOWN,
+	[1191] = OPCODE_INFO_UNKNOWN,
+	[1192] = OPCODE_INFO_UNKNOWN,
+	[1193] = OPCODE_INFO_UNKNOWN,
+	[1194] = OPCODE_INFO_UNKNOWN,
+	[1195] = OPCODE_INFO_UNKNOWN,
+	[1196] = OPCODE_INFO_UNKNOWN,
+	[1197] = OPCODE_INFO_UNKNOWN,
+	[1198] = OPCODE_INFO_UNKNOWN,
+	[1199] = OPCODE_INFO_UNKNOWN,
+	[1200] = OPCODE_INFO_UNKNOWN,
+	[1201] = OPCODE_INFO_UNKNOWN,
+	[1202] = OPCODE_INFO_UNKNOWN,
+	[1203] = OPCODE_INFO_UNKNOWN,
+	[1204] = OPCODE_INFO_UNKNOWN,
+	[1205] = OPCODE_INFO_UNKNOWN,
+	[1206] = OPCODE_INFO_UNKNOWN,
+	[1207] = OPCODE_INFO_UNKNOWN,
+	[1208] = OPCODE_INFO_UNKNOWN,
+	[1209] = OPCODE_INFO_UNKNOWN,
+	[1210] = OPCODE_INFO_UNKNOWN,
+	[1211] = OPCODE_INFO_UNKNOWN,
+	[1212] = OPCODE_INFO_UNKNOWN,
+	[1213] = OPCODE_INFO_UNKNOWN,
+	[1214] = OPCODE_INFO_UNKNOWN,
+	[1215] = OPCODE_INFO_UNKNOWN,
+	[1216] = OPCODE_INFO_UNKNOWN,
+	[1217] = OPCODE_INFO_UNKNOWN,
+	[1218] = OPCODE_INFO_UNKNOWN,
+	[1219] = OPCODE_INFO_UNKNOWN,
+	[1220] = OPCODE_INFO_UNKNOWN,
+	[1221] = OPCODE_INFO_UNKNOWN,
+	[1222] = OPCODE_INFO_UNKNOWN,
+	[1223] = OPCODE_INFO_UNKNOWN,
+	[1224] = OPCODE_INFO_UNKNOWN,
+	[1225] = OPCODE_INFO_UNKNOWN,
+	[1226] = OPCODE_INFO_UNKNOWN,
+	[1227] = OPCODE_INFO_UNKNOWN,
+	[1228] = OPCODE_INFO_UNKNOWN,
+	[1229] = OPCODE_INFO_UNKNOWN,
+	[1230] = OPCODE_INFO_UNKNOWN,
+	[1231] = OPCODE_INFO_UNKNOWN,
+	[1232] = OPCODE_INFO_UNKNOWN,
+	[1233] = OPCODE_INFO_UNKNOWN,
+	[1234] = OPCODE_INFO_UNKNOWN,
+	[1235] = OPCODE_INFO_UNKNOWN,
+	[1236] = OPCODE_INFO_UNKNOWN,
+	[1237] = OPCODE_INFO_UNKNOWN,
+	[1238] = OPCODE_INFO_UNKNOWN,
+	[1239] = OPCODE_INFO_UNKNOWN,
+	[1240] = OPCODE_INFO_UNKNOWN,
+	[1241] = OPCODE_INFO_UNKNOWN,
+	[1242] = OPCODE_INFO_UNKNOWN,
+	[1243] = OPCODE_INFO_UNKNOWN,
+	[1244] = OPCODE_INFO_UNKNOWN,
+	[1245] = OPCODE_INFO_UNKNOWN,
+	[1246] = OPCODE_INFO_UNKNOWN,
+	[1247] = OPCODE_INFO_UNKNOWN,
+	[1248] = OPCODE_INFO_UNKNOWN,
+	[1249] = OPCODE_INFO_UNKNOWN,
+	[1250] = OPCODE_INFO_UNKNOWN,
+	[1251] = OPCODE_INFO_UNKNOWN,
+	[1252] = OPCODE_INFO_UNKNOWN,
+	[1253] = OPCODE_INFO_UNKNOWN,
+	[1254] = OPCODE_INFO_UNKNOWN,
+	[1255] = OPCODE_INFO_UNKNOWN,
+	[1256] = OPCODE_INFO_UNKNOWN,
+	[1257] = OPCODE_INFO_UNKNOWN,
+	[1258] = OPCODE_INFO_UNKNOWN,
+	[1259] = OPCODE_INFO_UNKNOWN,
+	[1260] = OPCODE_INFO_UNKNOWN,
+	[1261] = OPCODE_INFO_UNKNOWN,
+	[1262] = OPCODE_INFO_UNKNOWN,
+	[1263] = OPCODE_INFO_UNKNOWN,
+	[1264] = OPCODE_INFO_UNKNOWN,
+	[1265] = OPCODE_INFO_UNKNOWN,
+	[1266] = OPCODE_INFO_UNKNOWN,
+	[1267] = OPCODE_INFO_UNKNOWN,
+	[1268] = OPCODE_INFO_UNKNOWN,
+	[1269] = OPCODE_INFO_UNKNOWN,
+	[1270] = OPCODE_INFO_UNKNOWN,
+	[1271] = OPCODE_INFO_UNKNOWN,
+	[1272] = OPCODE_INFO_UNKNOWN,
+	[1273] = OPCODE_INFO_UNKNOWN,
+	[1274] = OPCODE_INFO_UNKNOWN,
+	[1275] = OPCODE_INFO_UNKNOWN,
+	[1276] = OPCODE_INFO_UNKNOWN,
+	[1277] = OPCODE_INFO_UNKNOWN,
+	[1278] = OPCODE_INFO_UNKNOWN,
+	[1279] = OPCODE_INFO_UNKNOWN,
+	[1280] = OPCODE_INFO_UNKNOWN,
+	[1281] = OPCODE_INFO_UNKNOWN,
+	[1282] = OPCODE_INFO_UNKNOWN,
+	[1283] = OPCODE_INFO_UNKNOWN,
+	[1284] = OPCODE_INFO_UNKNOWN,
+	[1285] = OPCODE_INFO_UNKNOWN,
+	[1286] = OPCODE_INFO_UNKNOWN,
+	[1287] = OPCODE_INFO_UNKNOWN,
+	[1288] = OPCODE_INFO_UNKNOWN,
+	[1289] = OPCODE_INFO_UNKNOWN,
+	[1290] = OPCODE_INFO_UNKNOWN,
+	[1291] = OPCODE_INFO_UNKNOWN,
+	[1292] = OPCODE_INFO_UNKNOWN,
+	[1293] = OPCODE_INFO_UNKNOWN,
+	[1294] = OPCODE_INFO_UNKNOWN,
+	[1295] = OPCODE_INFO_UNKNOWN,
+	[1296] = OPCODE_INFO_UNKNOWN,
+	[1297] = OPCODE_INFO_UNKNOWN,
+	[1298] = OPCODE_INFO_UNKNOWN,
+	[1299] = OPCODE_INFO_UNKNOWN,
+	[1300] = OPCODE_INFO_UNKNOWN,
+	[1301] = OPCODE_INFO_UNKNOWN,
+	[1302] = OPCODE_INFO_UNKNOWN,
+	[1303] = OPCODE_INFO_UNKNOWN,
+	[1304] = OPCODE_INFO_UNKNOWN,
+	[1305] = OPCODE_INFO_UNKNOWN,
+	[1306] = OPCODE_INFO_UNKNOWN,
+	[1307] = OPCODE_INFO_UNKNOWN,
+	[1308] = OPCODE_INFO_UNKNOWN,
+	[1309] = OPCODE_INFO_UNKNOWN,
+	[1310] = OPCODE_INFO_UNKNOWN,
+	[1311] = OPCODE_INFO_UNKNOWN,
+	[1312] = OPCODE_INFO_UNKNOWN,
+	[1313] = OPCODE_INFO_UNKNOWN,
+	[1314] = OPCODE_INFO_UNKNOWN,
+	[1315] = OPCODE_INFO_UNKNOWN,
+	[1316] = OPCODE_INFO_UNKNOWN,
+	[1317] = OPCODE_INFO_UNKNOWN,
+	[1318] = OPCODE_INFO_UNKNOWN,
+	[1319] = OPCODE_INFO_UNKNOWN,
+	[1320] = OPCODE_INFO_UNKNOWN,
+	[1321] = OPCODE_INFO_UNKNOWN,
+	[1322] = OPCODE_INFO_UNKNOWN,
+	[1323] = OPCODE_INFO_UNKNOWN,
+	[1324] = OPCODE_INFO_UNKNOWN,
+	[1325] = OPCODE_INFO_UNKNOWN,
+	[1326] = OPCODE_INFO_UNKNOWN,
+	[1327] = OPCODE_INFO_UNKNOWN,
+	[1328] = OPCODE_INFO_UNKNOWN,
+	[1329] = OPCODE_INFO_UNKNOWN,
+	[1330] = OPCODE_INFO_UNKNOWN,
+	[1331] = OPCODE_INFO_UNKNOWN,
+	[1332] = OPCODE_INFO_UNKNOWN,
+	[1333] = OPCODE_INFO_UNKNOWN,
+	[1334] = OPCODE_INFO_UNKNOWN,
+	[1335] = OPCODE_INFO_UNKNOWN,
+	[1336] = OPCODE_INFO_UNKNOWN,
+	[1337] = OPCODE_INFO_UNKNOWN,
+	[1338] = OPCODE_INFO_UNKNOWN,
+	[1339] = OPCODE_INFO_UNKNOWN,
+	[1340] = OPCODE_INFO_UNKNOWN,
+	[1341] = OPCODE_INFO_UNKNOWN,
+	[1342] = OPCODE_INFO_UNKNOWN,
+	[1343] = OPCODE_INFO_UNKNOWN,
+	[1344] = OPCODE_INFO_UNKNOWN,
+	[1345] = OPCODE_INFO_UNKNOWN,
+	[1346] = OPCODE_INFO_UNKNOWN,
+	[1347] = OPCODE_INFO_UNKNOWN,
+	[1348] = OPCODE_INFO_UNKNOWN,
+	[1349] = OPCODE_INFO_UNKNOWN,
+	[1350] = OPCODE_INFO_UNKNOWN,
+	[1351] = OPCODE_INFO_UNKNOWN,
+	[1352] = OPCODE_INFO_UNKNOWN,
+	[1353] = OPCODE_INFO_UNKNOWN,
+	[1354] = OPCODE_INFO_UNKNOWN,
+	[1355] = OPCODE_INFO_UNKNOWN,
+	[1356] = OPCODE_INFO_UNKNOWN,
+	[1357] = OPCODE_INFO_UNKNOWN,
+	[1358] = OPCODE_INFO_UNKNOWN,
+	[1359] = OPCODE_INFO_UNKNOWN,
+	[1360] = OPCODE_INFO_UNKNOWN,
+	[1361] = OPCODE_INFO_UNKNOWN,
+	[1362] = OPCODE_INFO_UNKNOWN,
+	[1363] = OPCODE_INFO_UNKNOWN,
+	[1364] = OPCODE_INFO_UNKNOWN,
+	[1365] = OPCODE_INFO_UNKNOWN,
+	[1366] = OPCODE_INFO_UNKNOWN,
+	[1367] = OPCODE_INFO_UNKNOWN,
+	[1368] = OPCODE_INFO_UNKNOWN,
+	[1369] = OPCODE_INFO_UNKNOWN,
+	[1370] = OPCODE_INFO_UNKNOWN,
+	[1371] = OPCODE_INFO_UNKNOWN,
+	[1372] = OPCODE_INFO_UNKNOWN,
+	[1373] = OPCODE_INFO_UNKNOWN,
+	[1374] = OPCODE_INFO_UNKNOWN,
+	[1375] = OPCODE_INFO_UNKNOWN,
+	[1376] = OPCODE_INFO_UNKNOWN,
+	[1377] = OPCODE_INFO_UNKNOWN,
+	[1378] = OPCODE_INFO_UNKNOWN,
+	[1379] = OPCODE_INFO_UNKNOWN,
+	[1380] = OPCODE_INFO_UNKNOWN,
+	[1381] = OPCODE_INFO_UNKNOWN,
+	[1382] = OPCODE_INFO_UNKNOWN,
+	[1383] = OPCODE_INFO_UNKNOWN,
+	[1384] = OPCODE_INFO_UNKNOWN,
+	[1385] = OPCODE_INFO_UNKNOWN,
+	[1386] = OPCODE_INFO_UNKNOWN,
+	[1387] = OPCODE_INFO_UNKNOWN,
+	[1388] = OPCODE_INFO_UNKNOWN,
+	[1389] = OPCODE_INFO_UNKNOWN,
+	[1390] = OPCODE_INFO_UNKNOWN,
+	[1391] = OPCODE_INFO_UNKNOWN,
+	[1392] = OPCODE_INFO_UNKNOWN,
+	[1393] = OPCODE_INFO_UNKNOWN,
+	[1394] = OPCODE_INFO_UNKNOWN,
+	[1395] = OPCODE_INFO_UNKNOWN,
+	[1396] = OPCODE_INFO_UNKNOWN,
+	[1397] = OPCODE_INFO_UNKNOWN,
+	[1398] = OPCODE_INFO_UNKNOWN,
+	[1399] = OPCODE_INFO_UNKNOWN,
+	[1400] = OPCODE_INFO_UNKNOWN,
+	[1401] = OPCODE_INFO_UNKNOWN,
+	[1402] = OPCODE_INFO_UNKNOWN,
+	[1403] = OPCODE_INFO_UNKNOWN,
+	[1404] = OPCODE_INFO_UNKNOWN,
+	[1405] = OPCODE_INFO_UNKNOWN,
+	[1406] = OPCODE_INFO_UNKNOWN,
+	[1407] = OPCODE_INFO_UNKNOWN,
+	[1408] = OPCODE_INFO_UNKNOWN,
+	[1409] = OPCODE_INFO_UNKNOWN,
+	[1410] = OPCODE_INFO_UNKNOWN,
+	[1411] = OPCODE_INFO_UNKNOWN,
+	[1412] = OPCODE_INFO_UNKNOWN,
+	[1413] = OPCODE_INFO_UNKNOWN,
+	[1414] = OPCODE_INFO_UNKNOWN,
+	[1415] = OPCODE_INFO_UNKNOWN,
+	[1416] = OPCODE_INFO_UNKNOWN,
+	[1417] = OPCODE_INFO_UNKNOWN,
+	[1418] = OPCODE_INFO_UNKNOWN,
+	[1419] = OPCODE_INFO_UNKNOWN,
+	[1420] = OPCODE_INFO_UNKNOWN,
+	[1421] = OPCODE_INFO_UNKNOWN,
+	[1422] = OPCODE_INFO_UNKNOWN,
+	[1423] = OPCODE_INFO_UNKNOWN,
+	[1424] = OPCODE_INFO_UNKNOWN,
+	[1425] = OPCODE_INFO_UNKNOWN,
+	[1426] = OPCODE_INFO_UNKNOWN,
+	[1427] = OPCODE_INFO_UNKNOWN,
+	[1428] = OPCODE_INFO_UNKNOWN,
+	[1429] = OPCODE_INFO_UNKNOWN,
+	[1430] = OPCODE_INFO_UNKNOWN,
+	[1431] = OPCODE_INFO_UNKNOWN,
+	[1432] = OPCODE_INFO_UNKNOWN,
+	[1433] = OPCODE_INFO_UNKNOWN,
+	[1434] = OPCODE_INFO_UNKNOWN,
+	[1435] = OPCODE_INFO_UNKNOWN,
+	[1436] = OPCODE_INFO_UNKNOWN,
+	[1437] = OPCODE_INFO_UNKNOWN,
+	[1438] = OPCODE_INFO_UNKNOWN,
+	[1439] = OPCODE_INFO_UNKNOWN,
+	[1440] = OPCODE_INFO_UNKNOWN,
+	[1441] = OPCODE_INFO_UNKNOWN,
+	[1442] = OPCODE_INFO_UNKNOWN,
+	[1443] = OPCODE_INFO_UNKNOWN,
+	[1444] = OPCODE_INFO_UNKNOWN,
+	[1445] = OPCODE_INFO_UNKNOWN,
+	[1446] = OPCODE_INFO_UNKNOWN,
+	[1447] = OPCODE_INFO_UNKNOWN,
+	[1448] = OPCODE_INFO_UNKNOWN,
+	[1449] = OPCODE_INFO_UNKNOWN,
+	[1450] = OPCODE_INFO_UNKNOWN,
+	[1451] = OPCODE_INFO_UNKNOWN,
+	[1452] = OPCODE_INFO_UNKNOWN,
+	[1453] = OPCODE_INFO_UNKNOWN,
+	[1454] = OPCODE_INFO_UNKNOWN,
+	[1455] = OPCODE_INFO_UNKNOWN,
+	[1456] = OPCODE_INFO_UNKNOWN,
+	[1457] = OPCODE_INFO_UNKNOWN,
+	[1458] = OPCODE_INFO_UNKNOWN,
+	[1459] = OPCODE_INFO_UNKNOWN,
+	[1460] = OPCODE_INFO_UNKNOWN,
+	[1461] = OPCODE_INFO_UNKNOWN,
+	[1462] = OPCODE_INFO_UNKNOWN,
+	[1463] = OPCODE_INFO_UNKNOWN,
+	[1464] = OPCODE_INFO_UNKNOWN,
+	[1465] = OPCODE_INFO_UNKNOWN,
+	[1466] = OPCODE_INFO_UNKNOWN,
+	[1467] = OPCODE_INFO_UNKNOWN,
+	[1468] = OPCODE_INFO_UNKNOWN,
+	[1469] = OPCODE_INFO_UNKNOWN,
+	[1470] = OPCODE_INFO_UNKNOWN,
+	[1471] = OPCODE_INFO_UNKNOWN,
+	[1472] = OPCODE_INFO_UNKNOWN,
+	[1473] = OPCODE_INFO_UNKNOWN,
+	[1474] = OPCODE_INFO_UNKNOWN,
+	[1475] = OPCODE_INFO_UNKNOWN,
+	[1476] = OPCODE_INFO_UNKNOWN,
+	[1477] = OPCODE_INFO_UNKNOWN,
+	[1478] = OPCODE_INFO_UNKNOWN,
+	[1479] = OPCODE_INFO_UNKNOWN,
+	[1480] = OPCODE_INFO_UNKNOWN,
+	[1481] = OPCODE_INFO_UNKNOWN,
+	[1482] = OPCODE_INFO_UNKNOWN,
+	[1483] = OPCODE_INFO_UNKNOWN,
+	[1484] = OPCODE_INFO_UNKNOWN,
+	[1485] = OPCODE_INFO_UNKNOWN,
+	[1486] = OPCODE_INFO_UNKNOWN,
+	[1487] = OPCODE_INFO_UNKNOWN,
+	[1488] = OPCODE_INFO_UNKNOWN,
+	[1489] = OPCODE_INFO_UNKNOWN,
+	[1490] = OPCODE_INFO_UNKNOWN,
+	[1491] = OPCODE_INFO_UNKNOWN,
+	[1492] = OPCODE_INFO_UNKNOWN,
+	[1493] = OPCODE_INFO_UNKNOWN,
+	[1494] = OPCODE_INFO_UNKNOWN,
+	[1495] = OPCODE_INFO_UNKNOWN,
+	[1496] = OPCODE_INFO_UNKNOWN,
+	[1497] = OPCODE_INFO_UNKNOWN,
+	[1498] = OPCODE_INFO_UNKNOWN,
+	[1499] = OPCODE_INFO_UNKNOWN,
+	[1500] = OPCODE_INFO_UNKNOWN,
+	[1501] = OPCODE_INFO_UNKNOWN,
+	[1502] = OPCODE_INFO_UNKNOWN,
+	[1503] = OPCODE_INFO_UNKNOWN,
+	[1504] = OPCODE_INFO_UNKNOWN,
+	[1505] = OPCODE_INFO_UNKNOWN,
+	[1506] = OPCODE_INFO_UNKNOWN,
+	[1507] = OPCODE_INFO_UNKNOWN,
+	[1508] = OPCODE_INFO_UNKNOWN,
+	[1509] = OPCODE_INFO_UNKNOWN,
+	[1510] = OPCODE_INFO_UNKNOWN,
+	[1511] = OPCODE_INFO_UNKNOWN,
+	[1512] = OPCODE_INFO_UNKNOWN,
+	[1513] = OPCODE_INFO_UNKNOWN,
+	[1514] = OPCODE_INFO_UNKNOWN,
+	[1515] = OPCODE_INFO_UNKNOWN,
+	[1516] = OPCODE_INFO_UNKNOWN,
+	[1517] = OPCODE_INFO_UNKNOWN,
+	[1518] = OPCODE_INFO_UNKNOWN,
+	[1519] = OPCODE_INFO_UNKNOWN,
+	[1520] = OPCODE_INFO_UNKNOWN,
+	[1521] = OPCODE_INFO_UNKNOWN,
+	[1522] = OPCODE_INFO_UNKNOWN,
+	[1523] = OPCODE_INFO_UNKNOWN,
+	[1524] = OPCODE_INFO_UNKNOWN,
+	[1525] = OPCODE_INFO_UNKNOWN,
+	[1526] = OPCODE_INFO_UNKNOWN,
+	[1527] = OPCODE_INFO_UNKNOWN,
+	[1528] = OPCODE_INFO_UNKNOWN,
+	[1529] = OPCODE_INFO_UNKNOWN,
+	[1530] = OPCODE_INFO_UNKNOWN,
+	[1531] = OPCODE_INFO_UNKNOWN,
+	[1532] = OPCODE_INFO_UNKNOWN,
+	[1533] = OPCODE_INFO_UNKNOWN,
+	[1534] = OPCODE_INFO_UNKNOWN,
+	[1535] = OPCODE_INFO_UNKNOWN,
+	[1536] = OPCODE_INFO_UNKNOWN,
+	[1537] = OPCODE_INFO_UNKNOWN,
+	[1538] = OPCODE_INFO_UNKNOWN,
+	[1539] = OPCODE_INFO_UNKNOWN,
+	[1540] = OPCODE_INFO_UNKNOWN,
+	[1541] = OPCODE_INFO_UNKNOWN,
+	[1542] = OPCODE_INFO_UNKNOWN,
+	[1543] = OPCODE_INFO_UNKNOWN,
+	[1544] = OPCODE_INFO_UNKNOWN,
+	[1545] = OPCODE_INFO_UNKNOWN,
+	[1546] = OPCODE_INFO_UNKNOWN,
+	[1547] = OPCODE_INFO_UNKNOWN,
+	[1548] = OPCODE_INFO_UNKNOWN,
+	[1549] = OPCODE_INFO_UNKNOWN,
+	[1550] = OPCODE_INFO_UNKNOWN,
+	[1551] = OPCODE_INFO_UNKNOWN,
+	[1552] = OPCODE_INFO_UNKNOWN,
+	[1553] = OPCODE_INFO_UNKNOWN,
+	[1554] = OPCODE_INFO_UNKNOWN,
+	[1555] = OPCODE_INFO_UNKNOWN,
+	[1556] = OPCODE_INFO_UNKNOWN,
+	[1557] = OPCODE_INFO_UNKNOWN,
+	[1558] = OPCODE_INFO_UNKNOWN,
+	[1559] = OPCODE_INFO_UNKNOWN,
+	[1560] = OPCODE_INFO_UNKNOWN,
+	[1561] = OPCODE_INFO_UNKNOWN,
+	[1562] = OPCODE_INFO_UNKNOWN,
+	[1563] = OPCODE_INFO_UNKNOWN,
+	[1564] = OPCODE_INFO_UNKNOWN,
+	[1565] = OPCODE_INFO_UNKNOWN,
+	[1566] = OPCODE_INFO_UNKNOWN,
+	[1567] = OPCODE_INFO_UNKNOWN,
+	[1568] = OPCODE_INFO_UNKNOWN,
+	[1569] = OPCODE_INFO_UNKNOWN,
+	[1570] = OPCODE_INFO_UNKNOWN,
+	[1571] = OPCODE_INFO_UNKNOWN,
+	[1572] = OPCODE_INFO_UNKNOWN,
+	[1573] = OPCODE_INFO_UNKNOWN,
+	[1574] = OPCODE_INFO_UNKNOWN,
+	[1575] = OPCODE_INFO_UNKNOWN,
+	[1576] = OPCODE_INFO_UNKNOWN,
+	[1577] = OPCODE_INFO_UNKNOWN,
+	[1578] = OPCODE_INFO_UNKNOWN,
+	[1579] = OPCODE_INFO_UNKNOWN,
+	[1580] = OPCODE_INFO_UNKNOWN,
+	[1581] = OPCODE_INFO_UNKNOWN,
+	[1582] = OPCODE_INFO_UNKNOWN,
+	[1583] = OPCODE_INFO_UNKNOWN,
+	[1584] = OPCODE_INFO_UNKNOWN,
+	[1585] = OPCODE_INFO_UNKNOWN,
+	[1586] = OPCODE_INFO_UNKNOWN,
+	[1587] = OPCODE_INFO_UNKNOWN,
+	[1588] = OPCODE_INFO_UNKNOWN,
+	[1589] = OPCODE_INFO_UNKNOWN,
+	[1590] = OPCODE_INFO_UNKNOWN,
+	[1591] = OPCODE_INFO_UNKNOWN,
+	[1592] = OPCODE_INFO_UNKNOWN,
+	[1593] = OPCODE_INFO_UNKNOWN,
+	[1594] = OPCODE_INFO_UNKNOWN,
+	[1595] = OPCODE_INFO_UNKNOWN,
+	[1596] = OPCODE_INFO_UNKNOWN,
+	[1597] = OPCODE_INFO_UNKNOWN,
+	[1598] = OPCODE_INFO_UNKNOWN,
+	[1599] = OPCODE_INFO_UNKNOWN,
+	[1600] = OPCODE_INFO_UNKNOWN,
+	[1601] = OPCODE_INFO_UNKNOWN,
+	[1602] = OPCODE_INFO_UNKNOWN,
+	[1603] = OPCODE_INFO_UNKNOWN,
+	[1604] = OPCODE_INFO_UNKNOWN,
+	[1605] = OPCODE_INFO_UNKNOWN,
+	[1606] = OPCODE_INFO_UNKNOWN,
+	[1607] = OPCODE_INFO_UNKNOWN,
+	[1608] = OPCODE_INFO_UNKNOWN,
+	[1609] = OPCODE_INFO_UNKNOWN,
+	[1610] = OPCODE_INFO_UNKNOWN,
+	[1611] = OPCODE_INFO_UNKNOWN,
+	[1612] = OPCODE_INFO_UNKNOWN,
+	[1613] = OPCODE_INFO_UNKNOWN,
+	[1614] = OPCODE_INFO_UNKNOWN,
+	[1615] = OPCODE_INFO_UNKNOWN,
+	[1616] = OPCODE_INFO_UNKNOWN,
+	[1617] = OPCODE_INFO_UNKNOWN,
+	[1618] = OPCODE_INFO_UNKNOWN,
+	[1619] = OPCODE_INFO_UNKNOWN,
+	[1620] = OPCODE_INFO_UNKNOWN,
+	[1621] = OPCODE_INFO_UNKNOWN,
+	[1622] = OPCODE_INFO_UNKNOWN,
+	[1623] = OPCODE_INFO_UNKNOWN,
+	[1624] = OPCODE_INFO_UNKNOWN,
+	[1625] = OPCODE_INFO_UNKNOWN,
+	[1626] = OPCODE_INFO_UNKNOWN,
+	[1627] = OPCODE_INFO_UNKNOWN,
+	[1628] = OPCODE_INFO_UNKNOWN,
+	[1629] = OPCODE_INFO_UNKNOWN,
+	[1630] = OPCODE_INFO_UNKNOWN,
+	[1631] = OPCODE_INFO_UNKNOWN,
+	[1632] = OPCODE_INFO_UNKNOWN,
+	[1633] = OPCODE_INFO_UNKNOWN,
+	[1634] = OPCODE_INFO_UNKNOWN,
+	[1635] = OPCODE_INFO_UNKNOWN,
+	[1636] = OPCODE_INFO_UNKNOWN,
+	[1637] = OPCODE_INFO_UNKNOWN,
+	[1638] = OPCODE_INFO_UNKNOWN,
+	[1639] = OPCODE_INFO_UNKNOWN,
+	[1640] = OPCODE_INFO_UNKNOWN,
+	[1641] = OPCODE_INFO_UNKNOWN,
+	[1642] = OPCODE_INFO_UNKNOWN,
+	[1643] = OPCODE_INFO_UNKNOWN,
+	[1644] = OPCODE_INFO_UNKNOWN,
+	[1645] = OPCODE_INFO_UNKNOWN,
+	[1646] = OPCODE_INFO_UNKNOWN,
+	[1647] = OPCODE_INFO_UNKNOWN,
+	[1648] = OPCODE_INFO_UNKNOWN,
+	[1649] = OPCODE_INFO_UNKNOWN,
+	[1650] = OPCODE_INFO_UNKNOWN,
+	[1651] = OPCODE_INFO_UNKNOWN,
+	[1652] = OPCODE_INFO_UNKNOWN,
+	[1653] = OPCODE_INFO_UNKNOWN,
+	[1654] = OPCODE_INFO_UNKNOWN,
+	[1655] = OPCODE_INFO_UNKNOWN,
+	[1656] = OPCODE_INFO_UNKNOWN,
+	[1657] = OPCODE_INFO_UNKNOWN,
+	[1658] = OPCODE_INFO_UNKNOWN,
+	[1659] = OPCODE_INFO_UNKNOWN,
+	[1660] = OPCODE_INFO_UNKNOWN,
+	[1661] = OPCODE_INFO_UNKNOWN,
+	[1662] = OPCODE_INFO_UNKNOWN,
+	[1663] = OPCODE_INFO_UNKNOWN,
+	[1664] = OPCODE_INFO_UNKNOWN,
+	[1665] = OPCODE_INFO_UNKNOWN,
+	[1666] = OPCODE_INFO_UNKNOWN,
+	[1667] = OPCODE_INFO_UNKNOWN,
+	[1668] = OPCODE_INFO_UNKNOWN,
+	[1669] = OPCODE_INFO_UNKNOWN,
+	[1670] = OPCODE_INFO_UNKNOWN,
+	[1671] = OPCODE_INFO_UNKNOWN,
+	[1672] = OPCODE_INFO_UNKNOWN,
+	[1673] = OPCODE_INFO_UNKNOWN,
+	[1674] = OPCODE_INFO_UNKNOWN,
+	[1675] = OPCODE_INFO_UNKNOWN,
+	[1676] = OPCODE_INFO_UNKNOWN,
+	[1677] = OPCODE_INFO_UNKNOWN,
+	[1678] = OPCODE_INFO_UNKNOWN,
+	[1679] = OPCODE_INFO_UNKNOWN,
+	[1680] = OPCODE_INFO_UNKNOWN,
+	[1681] = OPCODE_INFO_UNKNOWN,
+	[1682] = OPCODE_INFO_UNKNOWN,
+	[1683] = OPCODE_INFO_UNKNOWN,
+	[1684] = OPCODE_INFO_UNKNOWN,
+	[1685] = OPCODE_INFO_UNKNOWN,
+	[1686] = OPCODE_INFO_UNKNOWN,
+	[1687] = OPCODE_INFO_UNKNOWN,
+	[1688] = OPCODE_INFO_UNKNOWN,
+	[1689] = OPCODE_INFO_UNKNOWN,
+	[1690] = OPCODE_INFO_UNKNOWN,
+	[1691] = OPCODE_INFO_UNKNOWN,
+	[1692] = OPCODE_INFO_UNKNOWN,
+	[1693] = OPCODE_INFO_UNKNOWN,
+	[1694] = OPCODE_INFO_UNKNOWN,
+	[1695] = OPCODE_INFO_UNKNOWN,
+	[1696] = OPCODE_INFO_UNKNOWN,
+	[1697] = OPCODE_INFO_UNKNOWN,
+	[1698] = OPCODE_INFO_UNKNOWN,
+	[1699] = OPCODE_INFO_UNKNOWN,
+	[1700] = OPCODE_INFO_UNKNOWN,
+	[1701] = OPCODE_INFO_UNKNOWN,
+	[1702] = OPCODE_INFO_UNKNOWN,
+	[1703] = OPCODE_INFO_UNKNOWN,
+	[1704] = OPCODE_INFO_UNKNOWN,
+	[1705] = OPCODE_INFO_UNKNOWN,
+	[1706] = OPCODE_INFO_UNKNOWN,
+	[1707] = OPCODE_INFO_UNKNOWN,
+	[1708] = OPCODE_INFO_UNKNOWN,
+	[1709] = OPCODE_INFO_UNKNOWN,
+	[1710] = OPCODE_INFO_UNKNOWN,
+	[1711] = OPCODE_INFO_UNKNOWN,
+	[1712] = OPCODE_INFO_UNKNOWN,
+	[1713] = OPCODE_INFO_UNKNOWN,
+	[1714] = OPCODE_INFO_UNKNOWN,
+	[1715] = OPCODE_INFO_UNKNOWN,
+	[1716] = OPCODE_INFO_UNKNOWN,
+	[1717] = OPCODE_INFO_UNKNOWN,
+	[1718] = OPCODE_INFO_UNKNOWN,
+	[1719] = OPCODE_INFO_UNKNOWN,
+	[1720] = OPCODE_INFO_UNKNOWN,
+	[1721] = OPCODE_INFO_UNKNOWN,
+	[1722] = OPCODE_INFO_UNKNOWN,
+	[1723] = OPCODE_INFO_UNKNOWN,
+	[1724] = OPCODE_INFO_UNKNOWN,
+	[1725] = OPCODE_INFO_UNKNOWN,
+	[1726] = OPCODE_INFO_UNKNOWN,
+	[1727] = OPCODE_INFO_UNKNOWN,
+	[1728] = OPCODE_INFO_UNKNOWN,
+	[1729] = OPCODE_INFO_UNKNOWN,
+	[1730] = OPCODE_INFO_UNKNOWN,
+	[1731] = OPCODE_INFO_UNKNOWN,
+	[1732] = OPCODE_INFO_UNKNOWN,
+	[1733] = OPCODE_INFO_UNKNOWN,
+	[1734] = OPCODE_INFO_UNKNOWN,
+	[1735] = OPCODE_INFO_UNKNOWN,
+	[1736] = OPCODE_INFO_UNKNOWN,
+	[1737] = OPCODE_INFO_UNKNOWN,
+	[1738] = OPCODE_INFO_UNKNOWN,
+	[1739] = OPCODE_INFO_UNKNOWN,
+	[1740] = OPCODE_INFO_UNKNOWN,
+	[1741] = OPCODE_INFO_UNKNOWN,
+	[1742] = OPCODE_INFO_UNKNOWN,
+	[1743] = OPCODE_INFO_UNKNOWN,
+	[1744] = OPCODE_INFO_UNKNOWN,
+	[1745] = OPCODE_INFO_UNKNOWN,
+	[1746] = OPCODE_INFO_UNKNOWN,
+	[1747] = OPCODE_INFO_UNKNOWN,
+	[1748] = OPCODE_INFO_UNKNOWN,
+	[1749] = OPCODE_INFO_UNKNOWN,
+	[1750] = OPCODE_INFO_UNKNOWN,
+	[1751] = OPCODE_INFO_UNKNOWN,
+	[1752] = OPCODE_INFO_UNKNOWN,
+	[1753] = OPCODE_INFO_UNKNOWN,
+	[1754] = OPCODE_INFO_UNKNOWN,
+	[1755] = OPCODE_INFO_UNKNOWN,
+	[1756] = OPCODE_INFO_UNKNOWN,
+	[1757] = OPCODE_INFO_UNKNOWN,
+	[1758] = OPCODE_INFO_UNKNOWN,
+	[1759] = OPCODE_INFO_UNKNOWN,
+	[1760] = OPCODE_INFO_UNKNOWN,
+	[1761] = OPCODE_INFO_UNKNOWN,
+	[1762] = OPCODE_INFO_UNKNOWN,
+	[1763] = OPCODE_INFO_UNKNOWN,
+	[1764] = OPCODE_INFO_UNKNOWN,
+	[1765] = OPCODE_INFO_UNKNOWN,
+	[1766] = OPCODE_INFO_UNKNOWN,
+	[1767] = OPCODE_INFO_UNKNOWN,
+	[1768] = OPCODE_INFO_UNKNOWN,
+	[1769] = OPCODE_INFO_UNKNOWN,
+	[1770] = OPCODE_INFO_UNKNOWN,
+	[1771] = OPCODE_INFO_UNKNOWN,
+	[1772] = OPCODE_INFO_UNKNOWN,
+	[1773] = OPCODE_INFO_UNKNOWN,
+	[1774] = OPCODE_INFO_UNKNOWN,
+	[1775] = OPCODE_INFO_UNKNOWN,
+	[1776] = OPCODE_INFO_UNKNOWN,
+	[1777] = OPCODE_INFO_UNKNOWN,
+	[1778] = OPCODE_INFO_UNKNOWN,
+	[1779] = OPCODE_INFO_UNKNOWN,
+	[1780] = OPCODE_INFO_UNKNOWN,
+	[1781] = OPCODE_INFO_UNKNOWN,
+	[1782] = OPCODE_INFO_UNKNOWN,
+	[1783] = OPCODE_INFO_UNKNOWN,
+	[1784] = OPCODE_INFO_UNKNOWN,
+	[1785] = OPCODE_INFO_UNKNOWN,
+	[1786] = OPCODE_INFO_UNKNOWN,
+	[1787] = OPCODE_INFO_UNKNOWN,
+	[1788] = OPCODE_INFO_UNKNOWN,
+	[1789] = OPCODE_INFO_UNKNOWN,
+	[1790] = OPCODE_INFO_UNKNOWN,
+	[1791] = OPCODE_INFO_UNKNOWN,
+	[1792] = OPCODE_INFO_UNKNOWN,
+	[1793] = OPCODE_INFO_UNKNOWN,
+	[1794] = OPCODE_INFO_UNKNOWN,
+	[1795] = OPCODE_INFO_UNKNOWN,
+	[1796] = OPCODE_INFO_UNKNOWN,
+	[1797] = OPCODE_INFO_UNKNOWN,
+	[1798] = OPCODE_INFO_UNKNOWN,
+	[1799] = OPCODE_INFO_UNKNOWN,
+	[1800] = OPCODE_INFO_UNKNOWN,
+	[1801] = OPCODE_INFO_UNKNOWN,
+	[1802] = OPCODE_INFO_UNKNOWN,
+	[1803] = OPCODE_INFO_UNKNOWN,
+	[1804] = OPCODE_INFO_UNKNOWN,
+	[1805] = OPCODE_INFO_UNKNOWN,
+	[1806] = OPCODE_INFO_UNKNOWN,
+	[1807] = OPCODE_INFO_UNKNOWN,
+	[1808] = OPCODE_INFO_UNKNOWN,
+	[1809] = OPCODE_INFO_UNKNOWN,
+	[1810] = OPCODE_INFO_UNKNOWN,
+	[1811] = OPCODE_INFO_UNKNOWN,
+	[1812] = OPCODE_INFO_UNKNOWN,
+	[1813] = OPCODE_INFO_UNKNOWN,
+	[1814] = OPCODE_INFO_UNKNOWN,
+	[1815] = OPCODE_INFO_UNKNOWN,
+	[1816] = OPCODE_INFO_UNKNOWN,
+	[1817] = OPCODE_INFO_UNKNOWN,
+	[1818] = OPCODE_INFO_UNKNOWN,
+	[1819] = OPCODE_INFO_UNKNOWN,
+	[1820] = OPCODE_INFO_UNKNOWN,
+	[1821] = OPCODE_INFO_UNKNOWN,
+	[1822] = OPCODE_INFO_UNKNOWN,
+	[1823] = OPCODE_INFO_UNKNOWN,
+	[1824] = OPCODE_INFO_UNKNOWN,
+	[1825] = OPCODE_INFO_UNKNOWN,
+	[1826] = OPCODE_INFO_UNKNOWN,
+	[1827] = OPCODE_INFO_UNKNOWN,
+	[1828] = OPCODE_INFO_UNKNOWN,
+	[1829] = OPCODE_INFO_UNKNOWN,
+	[1830] = OPCODE_INFO_UNKNOWN,
+	[1831] = OPCODE_INFO_UNKNOWN,
+	[1832] = OPCODE_INFO_UNKNOWN,
+	[1833] = OPCODE_INFO_UNKNOWN,
+	[1834] = OPCODE_INFO_UNKNOWN,
+	[1835] = OPCODE_INFO_UNKNOWN,
+	[1836] = OPCODE_INFO_UNKNOWN,
+	[1837] = OPCODE_INFO_UNKNOWN,
+	[1838] = OPCODE_INFO_UNKNOWN,
+	[1839] = OPCODE_INFO_UNKNOWN,
+	[1840] = OPCODE_INFO_UNKNOWN,
+	[1841] = OPCODE_INFO_UNKNOWN,
+	[1842] = OPCODE_INFO_UNKNOWN,
+	[1843] = OPCODE_INFO_UNKNOWN,
+	[1844] = OPCODE_INFO_UNKNOWN,
+	[1845] = OPCODE_INFO_UNKNOWN,
+	[1846] = OPCODE_INFO_UNKNOWN,
+	[1847] = OPCODE_INFO_UNKNOWN,
+	[1848] = OPCODE_INFO_UNKNOWN,
+	[1849] = OPCODE_INFO_UNKNOWN,
+	[1850] = OPCODE_INFO_UNKNOWN,
+	[1851] = OPCODE_INFO_UNKNOWN,
+	[1852] = OPCODE_INFO_UNKNOWN,
+	[1853] = OPCODE_INFO_UNKNOWN,
+	[1854] = OPCODE_INFO_UNKNOWN,
+	[1855] = OPCODE_INFO_UNKNOWN,
+	[1856] = OPCODE_INFO_UNKNOWN,
+	[1857] = OPCODE_INFO_UNKNOWN,
+	[1858] = OPCODE_INFO_UNKNOWN,
+	[1859] = OPCODE_INFO_UNKNOWN,
+	[1860] = OPCODE_INFO_UNKNOWN,
+	[1861] = OPCODE_INFO_UNKNOWN,
+	[1862] = OPCODE_INFO_UNKNOWN,
+	[1863] = OPCODE_INFO_UNKNOWN,
+	[1864] = OPCODE_INFO_UNKNOWN,
+	[1865] = OPCODE_INFO_UNKNOWN,
+	[1866] = OPCODE_INFO_UNKNOWN,
+	[1867] = OPCODE_INFO_UNKNOWN,
+	[1868] = OPCODE_INFO_UNKNOWN,
+	[1869] = OPCODE_INFO_UNKNOWN,
+	[1870] = OPCODE_INFO_UNKNOWN,
+	[1871] = OPCODE_INFO_UNKNOWN,
+	[1872] = OPCODE_INFO_UNKNOWN,
+	[1873] = OPCODE_INFO_UNKNOWN,
+	[1874] = OPCODE_INFO_UNKNOWN,
+	[1875] = OPCODE_INFO_UNKNOWN,
+	[1876] = OPCODE_INFO_UNKNOWN,
+	[1877] = OPCODE_INFO_UNKNOWN,
+	[1878] = OPCODE_INFO_UNKNOWN,
+	[1879] = OPCODE_INFO_UNKNOWN,
+	[1880] = OPCODE_INFO_UNKNOWN,
+	[1881] = OPCODE_INFO_UNKNOWN,
+	[1882] = OPCODE_INFO_UNKNOWN,
+	[1883] = OPCODE_INFO_UNKNOWN,
+	[1884] = OPCODE_INFO_UNKNOWN,
+	[1885] = OPCODE_INFO_UNKNOWN,
+	[1886] = OPCODE_INFO_UNKNOWN,
+	[1887] = OPCODE_INFO_UNKNOWN,
+	[1888] = OPCODE_INFO_UNKNOWN,
+	[1889] = OPCODE_INFO_UNKNOWN,
+	[1890] = OPCODE_INFO_UNKNOWN,
+	[1891] = OPCODE_INFO_UNKNOWN,
+	[1892] = OPCODE_INFO_UNKNOWN,
+	[1893] = OPCODE_INFO_UNKNOWN,
+	[1894] = OPCODE_INFO_UNKNOWN,
+	[1895] = OPCODE_INFO_UNKNOWN,
+	[1896] = OPCODE_INFO_UNKNOWN,
+	[1897] = OPCODE_INFO_UNKNOWN,
+	[1898] = OPCODE_INFO_UNKNOWN,
+	[1899] = OPCODE_INFO_UNKNOWN,
+	[1900] = OPCODE_INFO_UNKNOWN,
+	[1901] = OPCODE_INFO_UNKNOWN,
+	[1902] = OPCODE_INFO_UNKNOWN,
+	[1903] = OPCODE_INFO_UNKNOWN,
+	[1904] = OPCODE_INFO_UNKNOWN,
+	[1905] = OPCODE_INFO_UNKNOWN,
+	[1906] = OPCODE_INFO_UNKNOWN,
+	[1907] = OPCODE_INFO_UNKNOWN,
+	[1908] = OPCODE_INFO_UNKNOWN,
+	[1909] = OPCODE_INFO_UNKNOWN,
+	[1910] = OPCODE_INFO_UNKNOWN,
+	[1911] = OPCODE_INFO_UNKNOWN,
+	[1912] = OPCODE_INFO_UNKNOWN,
+	[1913] = OPCODE_INFO_UNKNOWN,
+	[1914] = OPCODE_INFO_UNKNOWN,
+	[1915] = OPCODE_INFO_UNKNOWN,
+	[1916] = OPCODE_INFO_UNKNOWN,
+	[1917] = OPCODE_INFO_UNKNOWN,
+	[1918] = OPCODE_INFO_UNKNOWN,
+	[1919] = OPCODE_INFO_UNKNOWN,
+	[1920] = OPCODE_INFO_UNKNOWN,
+	[1921] = OPCODE_INFO_UNKNOWN,
+	[1922] = OPCODE_INFO_UNKNOWN,
+	[1923] = OPCODE_INFO_UNKNOWN,
+	[1924] = OPCODE_INFO_UNKNOWN,
+	[1925] = OPCODE_INFO_UNKNOWN,
+	[1926] = OPCODE_INFO_UNKNOWN,
+	[1927] = OPCODE_INFO_UNKNOWN,
+	[1928] = OPCODE_INFO_UNKNOWN,
+	[1929] = OPCODE_INFO_UNKNOWN,
+	[1930] = OPCODE_INFO_UNKNOWN,
+	[1931] = OPCODE_INFO_UNKNOWN,
+	[1932] = OPCODE_INFO_UNKNOWN,
+	[1933] = OPCODE_INFO_UNKNOWN,
+	[1934] = OPCODE_INFO_UNKNOWN,
+	[1935] = OPCODE_INFO_UNKNOWN,
+	[1936] = OPCODE_INFO_UNKNOWN,
+	[1937] = OPCODE_INFO_UNKNOWN,
+	[1938] = OPCODE_INFO_UNKNOWN,
+	[1939] = OPCODE_INFO_UNKNOWN,
+	[1940] = OPCODE_INFO_UNKNOWN,
+	[1941] = OPCODE_INFO_UNKNOWN,
+	[1942] = OPCODE_INFO_UNKNOWN,
+	[1943] = OPCODE_INFO_UNKNOWN,
+	[1944] = OPCODE_INFO_UNKNOWN,
+	[1945] = OPCODE_INFO_UNKNOWN,
+	[1946] = OPCODE_INFO_UNKNOWN,
+	[1947] = OPCODE_INFO_UNKNOWN,
+	[1948] = OPCODE_INFO_UNKNOWN,
+	[1949] = OPCODE_INFO_UNKNOWN,
+	[1950] = OPCODE_INFO_UNKNOWN,
+	[1951] = OPCODE_INFO_UNKNOWN,
+	[1952] = OPCODE_INFO_UNKNOWN,
+	[1953] = OPCODE_INFO_UNKNOWN,
+	[1954] = OPCODE_INFO_UNKNOWN,
+	[1955] = OPCODE_INFO_UNKNOWN,
+	[1956] = OPCODE_INFO_UNKNOWN,
+	[1957] = OPCODE_INFO_UNKNOWN,
+	[1958] = OPCODE_INFO_UNKNOWN,
+	[1959] = OPCODE_INFO_UNKNOWN,
+	[1960] = OPCODE_INFO_UNKNOWN,
+	[1961] = OPCODE_INFO_UNKNOWN,
+	[1962] = OPCODE_INFO_UNKNOWN,
+	[1963] = OPCODE_INFO_UNKNOWN,
+	[1964] = OPCODE_INFO_UNKNOWN,
+	[1965] = OPCODE_INFO_UNKNOWN,
+	[1966] = OPCODE_INFO_UNKNOWN,
+	[1967] = OPCODE_INFO_UNKNOWN,
+	[1968] = OPCODE_INFO_UNKNOWN,
+	[1969] = OPCODE_INFO_UNKNOWN,
+	[1970] = OPCODE_INFO_UNKNOWN,
+	[1971] = OPCODE_INFO_UNKNOWN,
+	[1972] = OPCODE_INFO_UNKNOWN,
+	[1973] = OPCODE_INFO_UNKNOWN,
+	[1974] = OPCODE_INFO_UNKNOWN,
+	[1975] = OPCODE_INFO_UNKNOWN,
+	[1976] = OPCODE_INFO_UNKNOWN,
+	[1977] = OPCODE_INFO_UNKNOWN,
+	[1978] = OPCODE_INFO_UNKNOWN,
+	[1979] = OPCODE_INFO_UNKNOWN,
+	[1980] = OPCODE_INFO_UNKNOWN,
+	[1981] = OPCODE_INFO_UNKNOWN,
+	[1982] = OPCODE_INFO_UNKNOWN,
+	[1983] = OPCODE_INFO_UNKNOWN,
+	[1984] = OPCODE_INFO_UNKNOWN,
+	[1985] = OPCODE_INFO_UNKNOWN,
+	[1986] = OPCODE_INFO_UNKNOWN,
+	[1987] = OPCODE_INFO_UNKNOWN,
+	[1988] = OPCODE_INFO_UNKNOWN,
+	[1989] = OPCODE_INFO_UNKNOWN,
+	[1990] = OPCODE_INFO_UNKNOWN,
+	[1991] = OPCODE_INFO_UNKNOWN,
+	[1992] = OPCODE_INFO_UNKNOWN,
+	[1993] = OPCODE_INFO_UNKNOWN,
+	[1994] = OPCODE_INFO_UNKNOWN,
+	[1995] = OPCODE_INFO_UNKNOWN,
+	[1996] = OPCODE_INFO_UNKNOWN,
+	[1997] = OPCODE_INFO_UNKNOWN,
+	[1998] = OPCODE_INFO_UNKNOWN,
+	[1999] = OPCODE_INFO_UNKNOWN,
+	[2000] = OPCODE_INFO_UNKNOWN,
+	[2001] = OPCODE_INFO_UNKNOWN,
+	[2002] = OPCODE_INFO_UNKNOWN,
+	[2003] = OPCODE_INFO_UNKNOWN,
+	[2004] = OPCODE_INFO_UNKNOWN,
+	[2005] = OPCODE_INFO_UNKNOWN,
+	[2006] = OPCODE_INFO_UNKNOWN,
+	[2007] = OPCODE_INFO_UNKNOWN,
+	[2008] = OPCODE_INFO_UNKNOWN,
+	[2009] = OPCODE_INFO_UNKNOWN,
+	[2010] = OPCODE_INFO_UNKNOWN,
+	[2011] = OPCODE_INFO_UNKNOWN,
+	[2012] = OPCODE_INFO_UNKNOWN,
+	[2013] = OPCODE_INFO_UNKNOWN,
+	[2014] = OPCODE_INFO_UNKNOWN,
+	[2015] = OPCODE_INFO_UNKNOWN,
+	[2016] = OPCODE_INFO_UNKNOWN,
+	[2017] = OPCODE_INFO_UNKNOWN,
+	[2018] = OPCODE_INFO_UNKNOWN,
+	[2019] = OPCODE_INFO_UNKNOWN,
+	[2020] = OPCODE_INFO_UNKNOWN,
+	[2021] = OPCODE_INFO_UNKNOWN,
+	[2022] = OPCODE_INFO_UNKNOWN,
+	[2023] = OPCODE_INFO_UNKNOWN,
+	[2024] = OPCODE_INFO_UNKNOWN,
+	[2025] = OPCODE_INFO_UNKNOWN,
+	[2026] = OPCODE_INFO_UNKNOWN,
+	[2027] = OPCODE_INFO_UNKNOWN,
+	[2028] = OPCODE_INFO_UNKNOWN,
+	[2029] = OPCODE_INFO_UNKNOWN,
+	[2030] = OPCODE_INFO_UNKNOWN,
+	[2031] = OPCODE_INFO_UNKNOWN,
+	[2032] = OPCODE_INFO_UNKNOWN,
+	[2033] = OPCODE_INFO_UNKNOWN,
+	[2034] = OPCODE_INFO_UNKNOWN,
+	[2035] = OPCODE_INFO_UNKNOWN,
+	[2036] = OPCODE_INFO_UNKNOWN,
+	[2037] = OPCODE_INFO_UNKNOWN,
+	[2038] = OPCODE_INFO_UNKNOWN,
+	[2039] = OPCODE_INFO_UNKNOWN,
+	[2040] = OPCODE_INFO_UNKNOWN,
+	[2041] = OPCODE_INFO_UNKNOWN,
+	[2042] = OPCODE_INFO_UNKNOWN,
+	[2043] = OPCODE_INFO_UNKNOWN,
+	[2044] = OPCODE_INFO_UNKNOWN,
+	[2045] = OPCODE_INFO_UNKNOWN,
+	[2046] = OPCODE_INFO_UNKNOWN,
+	[2047] = OPCODE_INFO_UNKNOWN,
+};
+
+/* Where each register lives: GPR index (-1 if not a GPR), size in bytes and
+ * byte offset within the full register (1 for ah, ch, dh, bh) */
+typedef struct {
+	int8_t gpr;
+	int8_t size;
+	int8_t offset;
+} reg_info_t;
+
+static const reg_info_t regTable[REG_TABLE_SIZE] = {
+	{ -1, 0, 0 },
+	{ 0, 8, 0 },
+	{ 1, 8, 0 },
+	{ 2, 8, 0 },
+	{ 3, 8, 0 },
+	{ 4, 8, 0 },
+	{ 5, 8, 0 },
+	{ 6, 8, 0 },
+	{ 7, 8, 0 },
+	{ 8, 8, 0 },
+	{ 9, 8, 0 },
+	{ 10, 8, 0 },
+	{ 11, 8, 0 },
+	{ 12, 8, 0 },
+	{ 13, 8, 0 },
+	{ 14, 8, 0 },
+	{ 15, 8, 0 },
+	{ 0, 4, 0 },
+	{ 1, 4, 0 },
+	{ 2, 4, 0 },
+	{ 3, 4, 0 },
+	{ 4, 4, 0 },
+	{ 5, 4, 0 },
+	{ 6, 4, 0 },
+	{ 7, 4, 0 },
+	{ 8, 4, 0 },
+	{ 9, 4, 0 },
+	{ 10, 4, 0 },
+	{ 11, 4, 0 },
+	{ 12, 4, 0 },
+	{ 13, 4, 0 },
+	{ 14, 4, 0 },
+	{ 15, 4, 0 },
+	{ 0, 2, 0 },
+	{ 1, 2, 0 },
+	{ 2, 2, 0 },
+	{ 3, 2, 0 },
+	{ 4, 2, 0 },
+	{ 5, 2, 0 },
+	{ 6, 2, 0 },
+	{ 7, 2, 0 },
+	{ 8, 2, 0 },
+	{ 9, 2, 0 },
+	{ 10, 2, 0 },
+	{ 11, 2, 0 },
+	{ 12, 2, 0 },
+	{ 13, 2, 0 },
+	{ 14, 2, 0 },
+	{ 15, 2, 0 },
+	{ 0, 1, 0 },
+	{ 1, 1, 0 },
+	{ 2, 1, 0 },
+	{ 3, 1, 0 },
+	{ 0, 1, 1 },
+	{ 1, 1, 1 },
+	{ 2, 1, 1 },
+	{ 3, 1, 1 },
+	{ 8, 1, 0 },
+	{ 9, 1, 0 },
+	{ 10, 1, 0 },
+	{ 11, 1, 0 },
+	{ 12, 1, 0 },
+	{ 13, 1, 0 },
+	{ 14, 1, 0 },
+	{ 15, 1, 0 },
+	{ 4, 1, 0 },
+	{ 5, 1, 0 },
+	{ 6, 1, 0 },
+	{ 7, 1, 0 },
+	{ -1, 8, 0 },
+	{ -1, 8, 0 },
+	{ -1, 8, 0 },
+	{ -1, 8, 0 },
+	{ -1, 8, 0 },
+	{ -1, 8, 0 },
+	{ -1, 8, 0 },
+	{ -1, 8, 0 },
+	{ -1, 16, 0 },
+	{ -1, 16, 0 },
+	{ -1, 16, 0 },
+	{ -1, 16, 0 },
+	{ -1, 16, 0 },
+	{ -1, 16, 0 },
+	{ -1, 16, 0 },
+	{ -1, 16, 0 },
+	{ -1, 16, 0 },
+	{ -1, 16, 0 },
+	{ -1, 16, 0 },
+	{ -1, 16, 0 },
+	{ -1, 16, 0 },
+	{ -1, 16, 0 },
+	{ -1, 16, 0 },
+	{ -1, 16, 0 },
+};
+
+#endif
@@ -6,6 +6,23 @@
 #include<errno.h>
 #include<stdlib.h>
 #include<string.h>
+#include<stdint.h>
+#include<time.h>
+#include<sys/mman.h>
+#include<sys/stat.h>
+#include<sys/wait.h>
+#include<pthread.h>
+#include<sched.h>
+#include<poll.h>
+#include<signal.h>
+#include<sys/socket.h>
+#include<sys/un.h>
+#if defined(__x86_64__)
+#include<cpuid.h>
+#endif
+
+#include "opcodeTable.h"
+#include "peepholeRules.h"
 
 typedef struct {
 	int type;
@@ -14,6 +31,49 @@ typedef struct {
 	int p2;
 } instr_opnd_t;
 
+// Operand types, as encoded by parse_opnd in childProgramClient.c
+#define OPND_UNKNOWN -1
+#define OPND_NULL 0
+#define OPND_REG 1
+#define OPND_REG_PARTIAL 2
+#define OPND_BASE_DISP 3
+#define OPND_IMMED_INT 4
+#define OPND_IMMED_INT64 5
+#define OPND_IMMED_FLOAT 6
+#define OPND_NEAR_PC 7
+#define OPND_FAR_PC 8
+#define OPND_ABS_ADDR 9
+// Only sent by the parent: a branch to another instruction of the reply.
+// In the optimizer longParam holds the target instr_t; on the wire p1 is
+// the target's position in the reply.
+#define OPND_INSTR 10
+
+// Base-disp operands pack base, index and scale into p1 and the access
+// size and segment (0 none, 1 fs, 2 gs, 3 other) into p2
+int opnd_get_base(instr_opnd_t* opnd) {
+	return opnd->p1 & 0xFF;
+}
+
+int opnd_get_index(instr_opnd_t* opnd) {
+	return (opnd->p1 >> 8) & 0xFF;
+}
+
+int opnd_get_scale(instr_opnd_t* opnd) {
+	return (opnd->p1 >> 16) & 0xFF;
+}
+
+int opnd_get_mem_size(instr_opnd_t* opnd) {
+	return opnd->p2 & 0xFFFF;
+}
+
+int opnd_get_segment(instr_opnd_t* opnd) {
+	return (opnd->p2 >> 16) & 0xFF;
+}
+
+int opnd_is_memory_reference(instr_opnd_t* opnd) {
+	return opnd->type == OPND_BASE_DISP || opnd->type == OPND_ABS_ADDR;
+}
+
 typedef struct {
 	unsigned char* app_pc;
 	int opcode;
@@ -22,15 +82,84 @@ typedef struct {
 	int length;
 } instr_data_t;
 
+#define MSG_BUF_SIZE 2000
+#define MSG_CHUNK_SIZE 65536
+
+// Received messages are kept here for the lifetime of a block so that
+// instructions can be views straight over the bytes the child sent.
+// Chunks never move once allocated, and are reused from block to block.
+typedef struct MsgChunk {
+	struct MsgChunk* next;
+	int used;
+	unsigned char data[MSG_CHUNK_SIZE];
+} msg_chunk_t;
+
+typedef struct {
+	msg_chunk_t* first;
+	msg_chunk_t* current;
+} msg_arena_t;
+
+void msg_arena_init(msg_arena_t* arena) {
+	arena->first = NULL;
+	arena->current = NULL;
+}
+
+// Returns space for a message of up to maxLen bytes; call msg_arena_commit
+// with the number of bytes actually used before reserving again
+unsigned char* msg_arena_reserve(msg_arena_t* arena, int maxLen) {
+	if (arena->current != NULL && MSG_CHUNK_SIZE - arena->current->used >= maxLen) {
+		return arena->current->data + arena->current->used;
+	}
+	msg_chunk_t* next = (arena->current == NULL) ? arena->first : arena->current->next;
+	if (next == NULL) {
+		next = malloc(sizeof(msg_chunk_t));
+		next->next = NULL;
+		if (arena->current == NULL) {
+			arena->first = next;
+		} else {
+			arena->current->next = next;
+		}
+	}
+	next->used = 0;
+	arena->current = next;
+	return next->data;
+}
+
+void msg_arena_commit(msg_arena_t* arena, int len) {
+	// Keep every message 8-byte aligned, since they are read in place
+	arena->current->used += (len + 7) & ~7;
+}
+
+void msg_arena_reset(msg_arena_t* arena) {
+	arena->current = NULL;
+}
+
+void msg_arena_destroy(msg_arena_t* arena) {
+	msg_chunk_t* chunk = arena->first;
+	while (chunk != NULL) {
+		msg_chunk_t* next = chunk->next;
+		free(chunk);
+		chunk = next;
+	}
+	msg_arena_init(arena);
+}
+
+// iData, src and dst point into the received message (view) until a pass
+// first writes to them, at which point they are copied. Dirty state is
+// derived by comparing against the view, so nothing needs to be tracked.
 typedef struct Instr {
-	instr_data_t iData;
+	instr_data_t* iData;
 	instr_opnd_t* src;
 	instr_opnd_t* dst;
+	instr_data_t* view;
+	instr_data_t ownData;
 	int origIndex;
-	int dirty;
-	int dirtyInst;
-	int dirtySrc[8];
-	int dirtyDst[8];
+	// Scaled taken and not-taken counts the child sampled for a conditional
+	// branch (see branch_profile_t); both 0 if it sent none. For an
+	// indirect jmp or call, taken counts going to hotTarget.
+	int taken;
+	int notTaken;
+	unsigned char* hotTarget;
 	struct Instr* next;
 	struct Instr* prev;
 } instr_t;
@@ -41,20 +170,118 @@ typedef struct {
 	unsigned char* fall_through;
 } instrlist_t;
 
+instr_opnd_t* view_get_srcs(instr_data_t* view) {
+	return (instr_opnd_t*) (view + 1);
+}
+
+instr_opnd_t* view_get_dsts(instr_data_t* view) {
+	return view_get_srcs(view) + view->numSrc;
+}
+
 instr_t* instr_create() {
 	instr_t* result = malloc(sizeof(instr_t));
-	result->dirty = 1;
-	result->dirtyInst = 1;
-	result->iData.numSrc = 0;
-	result->iData.numDst = 0;
+	result->view = NULL;
+	result->iData = &result->ownData;
+	result->iData->app_pc = NULL;
+	result->iData->opcode = 0;
+	result->iData->numSrc = 0;
+	result->iData->numDst = 0;
+	result->iData->length = 0;
+	result->src = NULL;
+	result->dst = NULL;
+	result->origIndex = -1;
+	result->taken = 0;
+	result->notTaken = 0;
+	result->hotTarget = NULL;
+	result->next = NULL;
+	result->prev = NULL;
+	return result;
+}
+
+// A new instruction with room for its operands; it has no view, so it is
+// sent to the child in full
+instr_t* instr_build(int opcode, int numDst, int numSrc) {
+	instr_t* result = instr_create();
+	result->iData->opcode = opcode;
+	result->iData->numSrc = numSrc;
+	result->iData->numDst = numDst;
+	result->src = calloc(numSrc > 0 ? numSrc : 1, sizeof(instr_opnd_t));
+	result->dst = calloc(numDst > 0 ? numDst : 1, sizeof(instr_opnd_t));
+	return result;
+}
+
+// Builds an instruction directly over a message received from the child
+instr_t* instr_create_view(instr_data_t* msg) {
+	instr_t* result = malloc(sizeof(instr_t));
+	result->view = msg;
+	result->iData = msg;
+	result->src = view_get_srcs(msg);
+	result->dst = view_get_dsts(msg);
+	result->origIndex = -1;
+	result->taken = 0;
+	result->notTaken = 0;
+	result->hotTarget = NULL;
 	result->next = NULL;
 	result->prev = NULL;
 	return result;
 }
 
+int instr_owns_srcs(instr_t* instr) {
+	return instr->view == NULL || instr->src != view_get_srcs(instr->view);
+}
+
+int instr_owns_dsts(instr_t* instr) {
+	return instr->view == NULL || instr->dst != view_get_dsts(instr->view);
+}
+
+// Copy-on-write helpers; every setter goes through one of these first
+void instr_own_data(instr_t* instr) {
+	if (instr->iData == &instr->ownData) return;
+	instr->ownData = *instr->iData;
+	instr->iData = &instr->ownData;
+}
+
+void instr_own_srcs(instr_t* instr) {
+	if (instr_owns_srcs(instr)) return;
+	instr_opnd_t* copy = malloc(instr->iData->numSrc * sizeof(instr_opnd_t));
+	memcpy(copy, instr->src, instr->iData->numSrc * sizeof(instr_opnd_t));
+	instr->src = copy;
+}
+
+void instr_own_dsts(instr_t* instr) {
+	if (instr_owns_dsts(instr)) return;
+	instr_opnd_t* copy = malloc(instr->iData->numDst * sizeof(instr_opnd_t));
+	memcpy(copy, instr->dst, instr->iData->numDst * sizeof(instr_opnd_t));
+	instr->dst = copy;
+}
+
+int opnd_same(instr_opnd_t* a, instr_opnd_t* b) {
+	return a->type == b->type && a->longParam == b->longParam && a->p1 == b->p1 && a->p2 == b->p2;
+}
+
+int instr_is_dirty_inst(instr_t* instr) {
+	if (instr->view == NULL) return 1;
+	return instr->iData->app_pc != instr->view->app_pc || instr->iData->opcode != instr->view->opcode;
+}
+
+int instr_is_dirty_src(instr_t* instr, int s) {
+	if (instr->view == NULL) return 1;
+	if (!instr_owns_srcs(instr)) return 0;
+	return !opnd_same(&instr->src[s], &view_get_srcs(instr->view)[s]);
+}
+
+int instr_is_dirty(instr_t* instr) {
+	if (instr_is_dirty_inst(instr)) return 1;
+	if (!instr_owns_srcs(instr)) return 0;
+	for (int s = 0; s < instr->iData->numSrc; s++) {
+		if (instr_is_dirty_src(instr, s)) return 1;
+	}
+	return 0;
+}
+
 void instr_srcdst_destroy(instr_t* instr) {
-	free(instr->src);
-	free(instr->dst);
+	if (instr_owns_srcs(instr)) free(instr->src);
+	if (instr_owns_dsts(instr)) free(instr->dst);
 }
 
 void instr_destroy(instr_t* instr) {
@@ -62,15 +289,23 @@ void instr_destroy(instr_t* instr) {
 	free(instr);
 }
 
+// Clones share the original's view, so only already-modified parts are copied
 instr_t* instr_clone(instr_t* orig) {
-	instr_t* result = instr_create();
+	instr_t* result = malloc(sizeof(instr_t));
 	memcpy(result, orig, sizeof(instr_t));
 	result->next = NULL;
 	result->prev = NULL;
-	result->src = malloc(result->iData.numSrc * sizeof(instr_opnd_t));
-	result->dst = malloc(result->iData.numDst * sizeof(instr_opnd_t));
-	memcpy(result->src, orig->src, result->iData.numSrc * sizeof(instr_opnd_t));
-	memcpy(result->dst, orig->dst, result->iData.numDst * sizeof(instr_opnd_t));
+	if (orig->iData == &orig->ownData) {
+		result->iData = &result->ownData;
+	}
+	if (instr_owns_srcs(orig)) {
+		result->src = malloc(result->iData->numSrc * sizeof(instr_opnd_t));
+		memcpy(result->src, orig->src, result->iData->numSrc * sizeof(instr_opnd_t));
+	}
+	if (instr_owns_dsts(orig)) {
+		result->dst = malloc(result->iData->numDst * sizeof(instr_opnd_t));
+		memcpy(result->dst, orig->dst, result->iData->numDst * sizeof(instr_opnd_t));
+	}
 	return result;
 }
 
@@ -87,50 +322,375 @@ instr_t* instr_get_prev_app(instr_t* instr) {
 }
 
 int instr_length(instr_t* instr) {
-	return instr->iData.length;
+	return instr->iData->length;
 }
 
 unsigned char* instr_get_app_pc(instr_t* instr) {
-	return instr->iData.app_pc;
+	return instr->iData->app_pc;
 }
 
 instr_t* instr_set_translation(instr_t* instr, unsigned char* pc) {
-	instr->iData.app_pc = pc;
-	instr->dirty = 1;
-	instr->dirtyInst = 1;
+	instr_own_data(instr);
+	instr->iData->app_pc = pc;
+	return instr;
 }
 
 int instr_get_opcode(instr_t* instr) {
-	return instr->iData.opcode;
+	return instr->iData->opcode;
 }
 
 void instr_set_opcode(instr_t* instr, int opcode) {
-	instr->iData.opcode = opcode;
-	instr->dirty = 1;
-	instr->dirtyInst = 1;
+	instr_own_data(instr);
+	instr->iData->opcode = opcode;
+}
+
+instr_opnd_t opnd_create_reg(int reg) {
+	instr_opnd_t opnd = {OPND_REG, 0, reg, 0};
+	return opnd;
+}
+
+// A sign-extended 32-bit immediate
+instr_opnd_t opnd_create_immed_int(int value) {
+	instr_opnd_t opnd = {OPND_IMMED_INT, 0, value, 4};
+	return opnd;
+}
+
+void instr_set_src(instr_t* instr, int s, instr_opnd_t opnd) {
+	instr_own_srcs(instr);
+	instr->src[s] = opnd;
+}
+
+// Microarchitecture whose costs the passes optimize for; main() sets it
+// from the host CPU unless --uarch names one
+static int currentUarch = UARCH_SKYLAKE;
+
+static const char* uarchNames[NUM_UARCH] = {"skylake", "zen2", "netburst"};
+
+#define CPU_HAS_SSE2 0x1
+#define CPU_HAS_SSE41 0x2
+#define CPU_HAS_AVX2 0x4
+#define CPU_HAS_BMI2 0x8
+
+// The host CPU as cpuid reports it
+typedef struct {
+	char vendor[13];
+	int family;
+	int model;
+	uint32_t features;
+} cpu_model_t;
+
+void cpu_detect(cpu_model_t* cpu) {
+	memset(cpu, 0, sizeof(cpu_model_t));
+#if defined(__x86_64__)
+	unsigned int eax, ebx, ecx, edx;
+	if (!__get_cpuid(0, &eax, &ebx, &ecx, &edx)) return;
+	unsigned int maxLeaf = eax;
+	memcpy(cpu->vendor, &ebx, 4);
+	memcpy(cpu->vendor + 4, &edx, 4);
+	memcpy(cpu->vendor + 8, &ecx, 4);
+	__get_cpuid(1, &eax, &ebx, &ecx, &edx);
+	// The extended family and model only count for families 6 and 15
+	cpu->family = (eax >> 8) & 0xf;
+	cpu->model = (eax >> 4) & 0xf;
+	if (cpu->family == 0x6 || cpu->family == 0xf) cpu->model |= ((eax >> 16) & 0xf) << 4;
+	if (cpu->family == 0xf) cpu->family += (eax >> 20) & 0xff;
+	if (edx & bit_SSE2) cpu->features |= CPU_HAS_SSE2;
+	if (ecx & bit_SSE4_1) cpu->features |= CPU_HAS_SSE41;
+	if (maxLeaf >= 7) {
+		__cpuid_count(7, 0, eax, ebx, ecx, edx);
+		if (ebx & bit_AVX2) cpu->features |= CPU_HAS_AVX2;
+		if (ebx & bit_BMI2) cpu->features |= CPU_HAS_BMI2;
+	}
+#endif
+}
+
+// The modelled microarchitecture closest to cpu
+int cpu_uarch(const cpu_model_t* cpu) {
+	if (strcmp(cpu->vendor, "GenuineIntel") == 0 && cpu->family == 0xf) return UARCH_NETBURST;
+	if ((strcmp(cpu->vendor, "AuthenticAMD") == 0 || strcmp(cpu->vendor, "HygonGenuine") == 0) && cpu->family >= 0x17) {
+		return UARCH_ZEN2;
+	}
+	// Core-derived Intel parts, older AMD parts and anything else
+	return UARCH_SKYLAKE;
+}
+
+// Sets currentUarch from name, or from the host CPU if name is NULL;
+// returns 0 if name is not a known microarchitecture
+int select_uarch(const char* name) {
+	if (name != NULL) {
+		for (int u = 0; u < NUM_UARCH; u++) {
+			if (strcmp(name, uarchNames[u]) == 0) {
+				currentUarch = u;
+				return 1;
+			}
+		}
+		printf("Unknown microarchitecture %s; expected skylake, zen2 or netburst\n", name);
+		return 0;
+	}
+	cpu_model_t cpu;
+	cpu_detect(&cpu);
+	currentUarch = cpu_uarch(&cpu);
+	printf("Host CPU %s family 0x%x model 0x%x%s%s%s%s; optimizing for %s\n", cpu.vendor[0] ? cpu.vendor : "unknown",
+		cpu.family, cpu.model, cpu.features & CPU_HAS_SSE2 ? " sse2" : "", cpu.features & CPU_HAS_SSE41 ? " sse4.1" : "",
+		cpu.features & CPU_HAS_AVX2 ? " avx2" : "", cpu.features & CPU_HAS_BMI2 ? " bmi2" : "", uarchNames[currentUarch]);
+	return 1;
+}
+
+/* NUMA placement.
+ * /sys/devices/system/node/nodeN/cpulist names the CPUs of each node; a
+ * machine without it is one node, and then nothing is pinned. The server
+ * pins itself to the node it starts on before allocating anything, so its
+ * message arena and diff cache are placed there on first touch. Children
+ * it forks inherit that, as many as the node has CPUs to spare, so the
+ * lockstep pipe traffic never crosses sockets; the rest run anywhere.
+ * Replay workers are spread over the nodes and allocate after pinning.
+ */
+#define NUMA_MAX_NODES 64
+
+typedef struct {
+	int numNodes;
+	cpu_set_t cpus[NUMA_MAX_NODES];
+	// The affinity the process started with
+	cpu_set_t all;
+} numa_topology_t;
+
+static numa_topology_t numaTopology;
+
+// Parses a cpulist such as "0-3,8,10-11" into set; returns 0 if it is
+// malformed or empty, as it is for nodes with memory but no CPUs
+int numa_parse_cpulist(const char* list, cpu_set_t* set) {
+	CPU_ZERO(set);
+	const char* p = list;
+	while (*p != '\0' && *p != '\n') {
+		char* end;
+		long first = strtol(p, &end, 10);
+		if (end == p || first < 0) return 0;
+		long last = first;
+		p = end;
+		if (*p == '-') {
+			last = strtol(p + 1, &end, 10);
+			if (end == p + 1) return 0;
+			p = end;
+		}
+		for (long cpu = first; cpu <= last && cpu < CPU_SETSIZE; cpu++) CPU_SET(cpu, set);
+		if (*p == ',') p++;
+	}
+	return CPU_COUNT(set) > 0;
+}
+
+void numa_detect(numa_topology_t* topo) {
+	topo->numNodes = 0;
+	if (sched_getaffinity(0, sizeof(cpu_set_t), &topo->all) == -1) return;
+	// Node numbers may have gaps
+	for (int node = 0; node < NUMA_MAX_NODES; node++) {
+		char path[64];
+		snprintf(path, sizeof(path), "/sys/devices/system/node/node%d/cpulist", node);
+		FILE* f = fopen(path, "r");
+		if (f == NULL) continue;
+		char list[4096];
+		cpu_set_t* cpus = &topo->cpus[topo->numNodes];
+		if (fgets(list, sizeof(list), f) != NULL && numa_parse_cpulist(list, cpus)) {
+			// Only the CPUs we may run on
+			CPU_AND(cpus, cpus, &topo->all);
+			if (CPU_COUNT(cpus) > 0) topo->numNodes++;
+		}
+		fclose(f);
+	}
+}
+
+// Pins the calling thread to the CPUs of node; returns 0 if it could not
+int numa_bind(numa_topology_t* topo, int node) {
+	return sched_setaffinity(0, sizeof(cpu_set_t), &topo->cpus[node]) == 0;
+}
+
+// Pins the calling thread to the node it is running on; returns the node,
+// or -1 if there is only one or pinning failed
+int numa_bind_here(numa_topology_t* topo) {
+	if (topo->numNodes < 2) return -1;
+	int cpu = sched_getcpu();
+	for (int node = 0; node < topo->numNodes; node++) {
+		if (cpu >= 0 && CPU_ISSET(cpu, &topo->cpus[node])) return numa_bind(topo, node) ? node : -1;
+	}
+	return -1;
+}
+
+// O(1) lookup into the generated table; opcodes it doesn't list get the
+// conservative OPCODE_INFO_UNKNOWN entry
+const opcode_info_t* opcode_info(int opcode) {
+	return &opcodeTable[(unsigned) opcode & (OPCODE_TABLE_SIZE - 1)];
+}
+
+int opcode_get_inverse(int opcode) {
+	return opcode_info(opcode)->inverse;
+}
+
+int opcode_latency(int opcode) {
+	return opcode_info(opcode)->cost[currentUarch].latency;
+}
+
+int opcode_has_prop(int opcode, int prop) {
+	return (opcode_info(opcode)->props & prop) != 0;
 }
 
 int instr_is_cond_branch(instr_t* instr) {
-	int op = instr->iData.opcode;
-	if (op >= 152 && op <= 167) return 1;
-        if (op >= 26 && op <= 41) return 1;
-	return 0;       
+	return opcode_info(instr->iData->opcode)->branch == BR_COND;
+}
+
+// Flips a conditional branch's condition, leaving the target alone
+void instr_invert_cbr(instr_t* instr) {
+	instr_set_opcode(instr, opcode_get_inverse(instr_get_opcode(instr)));
+}
+
+// Register bitmasks: the 16 GPRs, then mm0-7, then xmm0-15
+#define REGMASK_MM_SHIFT 16
+#define REGMASK_XMM_SHIFT 24
+
+uint64_t reg_mask(int reg) {
+	if (reg <= 0 || reg >= REG_TABLE_SIZE) return 0;
+	if (regTable[reg].gpr >= 0) return 1ULL << regTable[reg].gpr;
+	if (reg >= DR_REG_MM0 && reg <= DR_REG_MM7) return 1ULL << (REGMASK_MM_SHIFT + reg - DR_REG_MM0);
+	return 1ULL << (REGMASK_XMM_SHIFT + reg - DR_REG_XMM0);
+}
+
+// Everything an instruction reads and writes, from its operands plus the
+// implicit uses in the opcode table
+typedef struct {
+	uint64_t regsRead;
+	uint64_t regsWritten;
+	uint8_t flagsRead;
+	uint8_t flagsWritten;
+	uint8_t readsMem;
+	uint8_t writesMem;
+	// Unknown operands or opcodes; nothing may move across it
+	uint8_t barrier;
+} instr_effects_t;
+
+static void effects_add_opnd(instr_effects_t* eff, instr_opnd_t* opnd, int isDst, int accessesMem) {
+	switch (opnd->type) {
+	case OPND_NULL:
+	case OPND_IMMED_INT:
+	case OPND_IMMED_INT64:
+	case OPND_IMMED_FLOAT:
+	case OPND_NEAR_PC:
+	case OPND_INSTR:
+		break;
+	case OPND_REG: {
+		uint64_t mask = reg_mask(opnd->p1);
+		if (mask == 0) {
+			eff->barrier = 1;
+		} else if (!isDst) {
+			eff->regsRead |= mask;
+		} else {
+			eff->regsWritten |= mask;
+			// 8- and 16-bit GPR writes (and all vector writes, to be safe)
+			// merge with the old value; 32-bit writes zero-extend
+			if (opnd->p1 >= REG_TABLE_SIZE || regTable[opnd->p1].gpr < 0 || regTable[opnd->p1].size < 4) {
+				eff->regsRead |= mask;
+			}
+		}
+		break;
+	}
+	case OPND_BASE_DISP:
+		eff->regsRead |= reg_mask(opnd_get_base(opnd)) | reg_mask(opnd_get_index(opnd));
+		if (opnd_get_segment(opnd) == 3) eff->barrier = 1;
+		// fall through
+	case OPND_ABS_ADDR:
+		if (accessesMem) {
+			if (isDst) {
+				eff->writesMem = 1;
+			} else {
+				eff->readsMem = 1;
+			}
+		}
+		break;
+	default:
+		eff->barrier = 1;
+		break;
+	}
+}
+
+void instr_get_effects(instr_t* instr, instr_effects_t* eff) {
+	int opcode = instr->iData->opcode;
+	const opcode_info_t* info = opcode_info(opcode);
+	// lea and multi-byte nops name memory without touching it
+	int accessesMem = opcode != OP_lea && opcode != OP_nop_modrm;
+	memset(eff, 0, sizeof(instr_effects_t));
+	for (int s = 0; s < instr->iData->numSrc; s++) {
+		effects_add_opnd(eff, &instr->src[s], 0, accessesMem);
+	}
+	for (int d = 0; d < instr->iData->numDst; d++) {
+		effects_add_opnd(eff, &instr->dst[d], 1, accessesMem);
+	}
+	eff->regsRead |= info->regsRead;
+	eff->regsWritten |= info->regsWritten;
+	eff->flagsRead = info->flagsRead;
+	eff->flagsWritten = info->flagsWritten;
+	if (info->props & OPI_LOAD) eff->readsMem = 1;
+	if (info->props & OPI_STORE) eff->writesMem = 1;
+	if (info->props & (OPI_BARRIER | OPI_CTI)) eff->barrier = 1;
+	// cmov only writes its destination if the condition holds
+	if (opcode >= OP_cmovo && opcode <= OP_cmovnle) eff->regsRead |= eff->regsWritten;
+	// Shifts by zero leave the flags alone, so unless the count is a known
+	// non-zero immediate the old flags may survive
+	if ((info->props & OPI_FLAGS_COND_WRITE) &&
+			!(instr->iData->numSrc > 0 && instr->src[0].type == OPND_IMMED_INT && (instr->src[0].p1 & 0x1F) != 0)) {
+		eff->flagsRead |= eff->flagsWritten;
+	}
+}
+
+// Cycles until an instruction's result is available, counting the load
+// for instructions that fold a memory source into an ALU op
+int instr_latency(instr_t* instr) {
+	int opcode = instr->iData->opcode;
+	int latency = opcode_latency(opcode);
+	if (opcode_has_prop(opcode, OPI_PURE) && opcode != OP_lea) {
+		for (int s = 0; s < instr->iData->numSrc; s++) {
+			if (opnd_is_memory_reference(&instr->src[s])) {
+				return latency + opcode_latency(OP_mov_ld);
+			}
+		}
+	}
+	return latency;
 }
 
 unsigned char* instr_get_branch_target_pc(instr_t* instr) {
-	if (instr->iData.numSrc == 0) return NULL;
-	if (instr->src[0].type != 7) return NULL;
+	if (instr->iData->numSrc == 0) return NULL;
+	if (instr->src[0].type != OPND_NEAR_PC) return NULL;
 	if (!instr_is_cond_branch(instr)) return NULL;
 	return (unsigned char*) instr->src[0].longParam;
 }
 
 void instr_set_branch_target_pc(instr_t* instr, unsigned char* pc) {
-	if (instr->iData.numSrc == 0) return;
-	if (instr->src[0].type != 7) return;
+	if (instr->iData->numSrc == 0) return;
+	if (instr->src[0].type != OPND_NEAR_PC) return;
 	if (!instr_is_cond_branch(instr)) return;
+	instr_own_srcs(instr);
 	instr->src[0].longParam = (int64_t) pc;
-	instr->dirty = 1;
-	instr->dirtySrc[0] = 1;
+}
+
+instr_t* instr_get_branch_target_instr(instr_t* instr) {
+	if (instr->iData->numSrc == 0) return NULL;
+	if (instr->src[0].type != OPND_INSTR) return NULL;
+	return (instr_t*) instr->src[0].longParam;
+}
+
+// Points a conditional branch at another instruction in the same list.
+// Clones of the branch keep pointing at the original target.
+void instr_set_branch_target_instr(instr_t* instr, instr_t* target) {
+	if (instr->iData->numSrc == 0) return;
+	if (!instr_is_cond_branch(instr)) return;
+	instr_own_srcs(instr);
+	instr->src[0].type = OPND_INSTR;
+	instr->src[0].longParam = (int64_t) target;
+	instr->src[0].p1 = 0;
+	instr->src[0].p2 = 0;
+}
+
+// Index of instr in its list
+int instr_get_position(instr_t* instr) {
+	int position = 0;
+	for (instr_t* prev = instr->prev; prev != NULL; prev = prev->prev) position++;
+	return position;
 }
 
 instrlist_t* instrlist_create() {
@@ -187,6 +747,33 @@ void instrlist_postinsert(instrlist_t* ilist, instr_t* where, instr_t* instr) {
 	}
 }
 
+void instrlist_preinsert(instrlist_t* ilist, instr_t* where, instr_t* instr) {
+	instr->next = where;
+	instr->prev = where->prev;
+	if (where->prev == NULL) {
+		ilist->first = instr;
+	} else {
+		where->prev->next = instr;
+	}
+	where->prev = instr;
+}
+
+// Unlinks instr, leaving it to the caller to destroy
+void instrlist_remove(instrlist_t* ilist, instr_t* instr) {
+	if (instr->prev == NULL) {
+		ilist->first = instr->next;
+	} else {
+		instr->prev->next = instr->next;
+	}
+	if (instr->next == NULL) {
+		ilist->last = instr->prev;
+	} else {
+		instr->next->prev = instr->prev;
+	}
+	instr->next = NULL;
+	instr->prev = NULL;
+}
+
 //The documentation doesn't specify here, so this returns the replaced instruction
 // Assumes that instruction is actually in the list
 instr_t* instrlist_replace(instrlist_t* ilist, instr_t* oldinst, instr_t* newinst) {
@@ -214,6 +801,19 @@ instr_t* instrlist_replace(instrlist_t* ilist, instr_t* oldinst, instr_t* newins
 	return oldinst;
 }
 
+// Collects the targets of branches within the list; returns how many, or
+// -1 if there are more than max
+int instrlist_get_branch_targets(instrlist_t* ilist, instr_t** targets, int max) {
+	int num = 0;
+	for (instr_t* instr = ilist->first; instr != NULL; instr = instr->next) {
+		instr_t* target = instr_get_branch_target_instr(instr);
+		if (target == NULL) continue;
+		if (num == max) return -1;
+		targets[num++] = target;
+	}
+	return num;
+}
+
 instrlist_t* instrlist_clone(instrlist_t* old) {
 	instrlist_t* result = instrlist_create();
 	instr_t* current = old->first;
@@ -239,13 +839,19 @@ void instrlist_set_fall_through_target(instrlist_t* bb, unsigned char* pc) {
 
 void optimize(instrlist_t* bb);
 
-void busy_read_loop(int fd, unsigned char* buf, int maxLen) {
-	int bytesRead = 0;
-	while (bytesRead <= 0) {
+// Spins until a message arrives; returns 0 if the other end has gone away
+int busy_read_loop(int fd, unsigned char* buf, int maxLen) {
+	int bytesRead = -1;
+	while (bytesRead < 0) {
 		bytesRead = read(fd, buf, maxLen);
+		if (bytesRead == -1 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) return 0;
 	}
+	return bytesRead;
 }
 
+// Sent in place of an origIndex for an instruction the optimizer created
+#define REPLY_NEW_INSTR -2
+
 unsigned char* writeIntToBuf(unsigned char* buf, int value) {
 	*((int*) buf) = value;
 	return buf + sizeof(int);
@@ -256,145 +862,4171 @@ unsigned char* writePtrToBuf(unsigned char* buf, unsigned char* value) {
 	return buf + sizeof(unsigned char*);
 }
 
-int main(int argc, char** argv) {
-	if (argc < 4) {
-		printf("Usage: parent <drrun location> <client location> <programs>\n");
-		return 0;
+uint64_t time_now_ns(clockid_t clock) {
+	struct timespec ts;
+	clock_gettime(clock, &ts);
+	return (uint64_t) ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+// Operands go out as type, longParam, p1 and p2; branches to other
+// instructions go out as their position in the reply
+unsigned char* writeOpndToBuf(unsigned char* buf, instr_opnd_t* opnd) {
+	if (opnd->type == OPND_INSTR) {
+		buf = writeIntToBuf(buf, OPND_INSTR);
+		buf = writePtrToBuf(buf, NULL);
+		buf = writeIntToBuf(buf, instr_get_position((instr_t*) opnd->longParam));
+		return writeIntToBuf(buf, 0);
 	}
-	//Hardcoded file paths; change these later
-	argv[1] = "../DynamoRIO-Linux-9.0.0/bin64/drrun";
-	argv[2] = "../rioTools/bin/libchildProgramClient.so";
-	int numChildren = argc - 3;
-	int* childReadPipes = malloc(numChildren * sizeof(int));
-	int* childWritePipes = malloc(numChildren * sizeof(int));
-	for (int i = 3; i < argc; i++) {
-		int pipeToChild[2];
-		int pipeToParent[2];
-		if (pipe(pipeToChild) == -1) {
-			printf("Error making pipe.\n");
-			return 1;
+	buf = writeIntToBuf(buf, opnd->type);
+	buf = writePtrToBuf(buf, (unsigned char*) opnd->longParam);
+	buf = writeIntToBuf(buf, opnd->p1);
+	return writeIntToBuf(buf, opnd->p2);
+}
+
+// Encodes the reply for one instruction of an optimized block into buf
+// and returns its length. This is exactly what the child reads.
+// Instructions the child never sent (see instr_build) are encoded in full
+// behind REPLY_NEW_INSTR: pc, opcode, source and destination counts, then
+// every source and destination.
+int encode_instr_reply(instr_t* toSend, unsigned char* buf) {
+	unsigned char* bufWrite = buf;
+	if (toSend->view == NULL) {
+		bufWrite = writeIntToBuf(bufWrite, REPLY_NEW_INSTR);
+		bufWrite = writePtrToBuf(bufWrite, toSend->iData->app_pc);
+		bufWrite = writeIntToBuf(bufWrite, toSend->iData->opcode);
+		bufWrite = writeIntToBuf(bufWrite, toSend->iData->numSrc);
+		bufWrite = writeIntToBuf(bufWrite, toSend->iData->numDst);
+		for (int s = 0; s < toSend->iData->numSrc; s++) {
+			bufWrite = writeOpndToBuf(bufWrite, &toSend->src[s]);
 		}
-		if (pipe2(pipeToParent, O_NONBLOCK) == -1) {
-			printf("Error making pipe 2.\n");
-			return 1;
+		for (int d = 0; d < toSend->iData->numDst; d++) {
+			bufWrite = writeOpndToBuf(bufWrite, &toSend->dst[d]);
 		}
-		int pid = fork();
-		if (pid == -1) {
-			printf("Error, failed to fork\n");
-		} else if (pid > 0) {
-			//Do parent stuff
-			close(pipeToChild[0]);
-			close(pipeToParent[1]);
-			childReadPipes[i-3] = pipeToParent[0];
-			childWritePipes[i-3] = pipeToChild[1];
-		} else {
-			//Child
-			close(pipeToChild[1]);
-			close(pipeToParent[0]);
-			char pipeWriteBuf[10];
-			char pipeReadBuf[10];
-			sprintf(pipeReadBuf, "%d", pipeToChild[0]);
-			sprintf(pipeWriteBuf, "%d", pipeToParent[1]);
-			execl(argv[1], argv[1], "-c", argv[2], pipeReadBuf, pipeWriteBuf, "--", argv[i], (char *) NULL);
-			//Whoops, something went wrong
-			printf("Error executing program.\n");
-			return 1;
+		return (int) (bufWrite - buf);
+	}
+	bufWrite = writeIntToBuf(bufWrite, toSend->origIndex);
+	int dirty = instr_is_dirty(toSend);
+	bufWrite = writeIntToBuf(bufWrite, dirty);
+	if (dirty) {
+		//Handle dirty stuff
+		int dirtyInst = instr_is_dirty_inst(toSend);
+		bufWrite = writeIntToBuf(bufWrite, dirtyInst);
+		if (dirtyInst) {
+			bufWrite = writePtrToBuf(bufWrite, toSend->iData->app_pc);
+			bufWrite = writeIntToBuf(bufWrite, toSend->iData->opcode);
+		}
+		for (int s = 0; s < toSend->iData->numSrc; s++) {
+			int dirtySrc = instr_is_dirty_src(toSend, s);
+			bufWrite = writeIntToBuf(bufWrite, dirtySrc);
+			if (dirtySrc) bufWrite = writeOpndToBuf(bufWrite, &toSend->src[s]);
 		}
 	}
-	unsigned char* buf = malloc(2000);
-	int* isRunning = malloc(numChildren * sizeof(int));
-	int childrenLeft = numChildren;
-	for (int i = 0; i < numChildren; i++) {
-		isRunning[i] = 1;
+	return (int) (bufWrite - buf);
+}
+
+// A capture file records every block received from the children together
+// with the diff that was sent back, so the optimizer can be replayed
+// offline with --replay. It is a capture_header_t followed by records; a
+// record is a capture_record_t, the numInstrs messages the child sent,
+// then every message of the reply (one per instruction, the -1 end marker
+// and the fall-through target). Each message is a capture_msg_t followed
+// by its bytes, and everything is 8-byte aligned so blocks can be decoded
+// in place from the mapping. The file is only ever appended to; a record
+// with length 0 is one the writer never finished, and ends the capture.
+#define CAPTURE_MAGIC 0x50414352
+#define CAPTURE_VERSION 2
+#define CAPTURE_GROW_SIZE (16 << 20)
+#define CAPTURE_ALIGN(len) (((len) + 7) & ~(size_t) 7)
+
+typedef struct {
+	uint32_t magic;
+	uint32_t version;
+} capture_header_t;
+
+typedef struct {
+	uint32_t length;
+	uint32_t childId;
+	uint64_t timestamp;
+	uint32_t numInstrs;
+	// If not 0, the block's branch profiles follow its instructions as one
+	// more message
+	uint32_t numProfiles;
+} capture_record_t;
+
+typedef struct {
+	uint32_t length;
+	uint32_t reserved;
+} capture_msg_t;
+
+typedef struct {
+	int fd;
+	unsigned char* map;
+	size_t mapped;
+	size_t used;
+	size_t record;
+} capture_t;
+
+// Returns the offset just past the last complete record, or 0 if the
+// mapping does not start with a valid capture header
+size_t capture_end(unsigned char* map, size_t size) {
+	capture_header_t* header = (capture_header_t*) map;
+	if (size < sizeof(capture_header_t) || header->magic != CAPTURE_MAGIC || header->version != CAPTURE_VERSION) {
+		return 0;
 	}
-	while (1) {
-	for (int i = 0; i < numChildren; i++) {
-		if (!isRunning[i]) continue;
-		int bytesRead = read(childReadPipes[i], buf, 2000);
-		if (bytesRead == -1) {
-			if ((errno == EAGAIN) || (errno == EWOULDBLOCK)) {
-				continue;
-			} else {
-				printf("Error: read failed\n");
-				return 1;
-			}
+	size_t offset = sizeof(capture_header_t);
+	while (offset + sizeof(capture_record_t) <= size) {
+		capture_record_t* record = (capture_record_t*) (map + offset);
+		if (record->length == 0 || record->length > size - offset) break;
+		offset += record->length;
+	}
+	return offset;
+}
+
+static int capture_reserve(capture_t* capture, size_t len) {
+	if (capture->used + len <= capture->mapped) return 0;
+	size_t newSize = capture->mapped + (len > CAPTURE_GROW_SIZE ? CAPTURE_ALIGN(len) : CAPTURE_GROW_SIZE);
+	if (ftruncate(capture->fd, newSize) == -1) return -1;
+	unsigned char* map = capture->map == NULL
+		? mmap(NULL, newSize, PROT_READ | PROT_WRITE, MAP_SHARED, capture->fd, 0)
+		: mremap(capture->map, capture->mapped, newSize, MREMAP_MAYMOVE);
+	if (map == MAP_FAILED) return -1;
+	capture->map = map;
+	capture->mapped = newSize;
+	return 0;
+}
+
+static int capture_open_failed(capture_t* capture) {
+	if (capture->map != NULL) munmap(capture->map, capture->mapped);
+	close(capture->fd);
+	return -1;
+}
+
+// Opens path for recording, appending to it if it is already a capture.
+// Any other non-empty file, including a capture from another version, is
+// refused rather than overwritten.
+int capture_open(capture_t* capture, const char* path) {
+	capture->fd = open(path, O_RDWR | O_CREAT, 0644);
+	if (capture->fd == -1) return -1;
+	capture->map = NULL;
+	capture->mapped = 0;
+	capture->used = 0;
+	struct stat st;
+	capture_header_t existing;
+	if (fstat(capture->fd, &st) == -1) return capture_open_failed(capture);
+	if (st.st_size > 0) {
+		if (st.st_size < (off_t) sizeof(capture_header_t) ||
+				pread(capture->fd, &existing, sizeof(existing), 0) != sizeof(existing) ||
+				existing.magic != CAPTURE_MAGIC) {
+			printf("Error: %s is not a capture file\n", path);
+			return capture_open_failed(capture);
 		}
-		if (bytesRead > 0) {
-			int numInstrs = *((int*) buf);
-			if (numInstrs == -1) {
-				isRunning[i] = 0;
-				childrenLeft--;
-				int err = write(childWritePipes[i], buf, sizeof(int));
-				continue;
-			}
-			int err = write(childWritePipes[i], buf, sizeof(int));
-			instrlist_t* bb = instrlist_create();
-			for (int j = 0; j < numInstrs; j++) {
-				busy_read_loop(childReadPipes[i], buf, 2000);
-				instr_t* newInst = instr_create();
-				instr_data_t* iData = (instr_data_t*) buf;
-				memcpy(&(newInst->iData), iData, sizeof(instr_data_t));
-				instr_opnd_t* oData = (instr_opnd_t*) (buf+sizeof(instr_data_t));
-				newInst->src = malloc(iData->numSrc * sizeof(instr_opnd_t));
-				memcpy(newInst->src, oData, iData->numSrc * sizeof(instr_opnd_t));
-				oData += iData->numSrc;
-				newInst->dst = malloc(iData->numDst * sizeof(instr_opnd_t));
-				memcpy(newInst->dst, oData, iData->numDst * sizeof(instr_opnd_t));
-				for (int op = 0; op < iData->numSrc; op++) {
-					newInst->dirtySrc[op] = 0;
-				}
-				for (int op = 0; op < iData->numDst; op++) {
-					newInst->dirtyDst[op] = 0;
-				}
-				newInst->dirty = 0;
-				newInst->dirtyInst = 0;
-				newInst->origIndex = j;
-				instrlist_append(bb, newInst);
-				err = write(childWritePipes[i], buf, sizeof(int));
-			}
-			optimize(bb);
-			busy_read_loop(childReadPipes[i], buf, sizeof(int));
-			instr_t* toSend = instrlist_first_app(bb);
-			while (toSend != NULL) {
-				unsigned char* bufWrite = buf;
-				bufWrite = writeIntToBuf(bufWrite, toSend->origIndex);
-				bufWrite = writeIntToBuf(bufWrite, toSend->dirty);
-				if (toSend->dirty) {
-					//Handle dirty stuff
-					bufWrite = writeIntToBuf(bufWrite, toSend->dirtyInst);
-					if (toSend->dirtyInst) {
-						bufWrite = writePtrToBuf(bufWrite, toSend->iData.app_pc);
-						bufWrite = writeIntToBuf(bufWrite, toSend->iData.opcode);
-					}
-					for (int s = 0; s < toSend->iData.numSrc; s++) {
-						bufWrite = writeIntToBuf(bufWrite, toSend->dirtySrc[s]);
-						if (toSend->dirtySrc[s]) {
-							bufWrite = writeIntToBuf(bufWrite, toSend->src[s].type);
-							bufWrite = writePtrToBuf(bufWrite, (unsigned char*) toSend->src[s].longParam);
-							bufWrite = writeIntToBuf(bufWrite, toSend->src[s].p1);
-							bufWrite = writeIntToBuf(bufWrite, toSend->src[s].p2);
-						}
-					}
-				}
-				toSend = instr_get_next_app(toSend);
-				err = write(childWritePipes[i], buf, (int) (bufWrite - buf));
-				busy_read_loop(childReadPipes[i], buf, sizeof(int));
-			}
-			writeIntToBuf(buf, -1);
-			err = write(childWritePipes[i], buf, sizeof(int));
-			busy_read_loop(childReadPipes[i], buf, sizeof(int));
-			writePtrToBuf(buf, bb->fall_through);
-			err = write(childWritePipes[i], buf, sizeof(unsigned char*));
-			instrlist_destroy(bb);
+		if (existing.version != CAPTURE_VERSION) {
+			printf("Error: %s is a version %u capture; this build records version %d\n",
+					path, existing.version, CAPTURE_VERSION);
+			return capture_open_failed(capture);
 		}
 	}
-	if (childrenLeft == 0) break;
+	if (capture_reserve(capture, st.st_size + 1) == -1) return capture_open_failed(capture);
+	capture->used = capture_end(capture->map, st.st_size);
+	if (st.st_size == 0) {
+		capture_header_t* header = (capture_header_t*) capture->map;
+		header->magic = CAPTURE_MAGIC;
+		header->version = CAPTURE_VERSION;
+		capture->used = sizeof(capture_header_t);
 	}
-	free(buf);
-	free(isRunning);
+	// Anything past the last complete record is garbage from a crashed writer
+	memset(capture->map + capture->used, 0, capture->mapped - capture->used);
 	return 0;
 }
 
+void capture_begin_record(capture_t* capture, int childId, int numInstrs, int numProfiles) {
+	if (capture_reserve(capture, sizeof(capture_record_t)) == -1) {
+		printf("Error: capture file could not grow\n");
+		exit(1);
+	}
+	capture->record = capture->used;
+	capture_record_t* record = (capture_record_t*) (capture->map + capture->record);
+	record->length = 0;
+	record->childId = childId;
+	record->timestamp = time_now_ns(CLOCK_REALTIME);
+	record->numInstrs = numInstrs;
+	record->numProfiles = numProfiles;
+	capture->used += sizeof(capture_record_t);
+}
+
+void capture_append_msg(capture_t* capture, unsigned char* buf, int len) {
+	if (capture_reserve(capture, sizeof(capture_msg_t) + CAPTURE_ALIGN(len)) == -1) {
+		printf("Error: capture file could not grow\n");
+		exit(1);
+	}
+	capture_msg_t* msg = (capture_msg_t*) (capture->map + capture->used);
+	msg->length = len;
+	msg->reserved = 0;
+	memcpy(msg + 1, buf, len);
+	capture->used += sizeof(capture_msg_t) + CAPTURE_ALIGN(len);
+}
+
+// Publishes the record; until then it reads as the end of the capture
+void capture_end_record(capture_t* capture) {
+	capture_record_t* record = (capture_record_t*) (capture->map + capture->record);
+	record->length = capture->used - capture->record;
+}
+
+void capture_close(capture_t* capture) {
+	munmap(capture->map, capture->mapped);
+	// The zeroed tail still reads as the end of the capture, so it stays usable
+	if (ftruncate(capture->fd, capture->used) == -1) {
+		printf("Error: capture file could not be trimmed\n");
+	}
+	close(capture->fd);
+}
+
+capture_msg_t* capture_msg_next(capture_msg_t* msg) {
+	return (capture_msg_t*) ((unsigned char*) (msg + 1) + CAPTURE_ALIGN(msg->length));
+}
+
+int replay_capture(const char* path, int numThreads, int iterations);
+uint64_t optimizer_signature(void);
+
+// Drops a record that will never be finished, e.g. when the child went away mid-block
+void capture_abort_record(capture_t* capture) {
+	memset(capture->map + capture->record, 0, capture->used - capture->record);
+	capture->used = capture->record;
+}
+
+// A growable sequence of messages, framed the same way as in a capture file
+typedef struct {
+	unsigned char* data;
+	size_t len;
+	size_t cap;
+} msg_seq_t;
+
+void msg_seq_append(msg_seq_t* seq, unsigned char* buf, int len) {
+	size_t needed = seq->len + sizeof(capture_msg_t) + CAPTURE_ALIGN(len);
+	if (needed > seq->cap) {
+		seq->cap = needed > 2 * seq->cap ? needed : 2 * seq->cap;
+		seq->data = realloc(seq->data, seq->cap);
+	}
+	capture_msg_t* msg = (capture_msg_t*) (seq->data + seq->len);
+	msg->length = len;
+	msg->reserved = 0;
+	memcpy(msg + 1, buf, len);
+	seq->len = needed;
+}
+
+uint64_t hash_bytes(unsigned char* data, size_t len) {
+	// FNV-1a
+	uint64_t hash = 0xcbf29ce484222325ULL;
+	for (size_t i = 0; i < len; i++) {
+		hash = (hash ^ data[i]) * 0x100000001b3ULL;
+	}
+	return hash;
+}
+
+// Maps the exact messages of a received block to the reply it got, so a
+// block seen before (from any client) is answered without optimizing it
+// again. optimize() only looks at the messages, so a hit is always exact.
+// Direct mapped; a colliding block replaces the older entry.
+#define DIFF_CACHE_BUCKETS 65536
+
+typedef struct {
+	uint64_t hash;
+	size_t keyLen;
+	size_t replyLen;
+	unsigned char* data;
+} diff_cache_entry_t;
+
+typedef struct {
+	diff_cache_entry_t* entries;
+	long hits;
+	long misses;
+} diff_cache_t;
+
+void diff_cache_init(diff_cache_t* cache) {
+	cache->entries = calloc(DIFF_CACHE_BUCKETS, sizeof(diff_cache_entry_t));
+	cache->hits = 0;
+	cache->misses = 0;
+}
+
+// Returns the cached reply for key, or NULL
+msg_seq_t* diff_cache_lookup(diff_cache_t* cache, msg_seq_t* key, uint64_t hash, msg_seq_t* reply) {
+	diff_cache_entry_t* entry = &cache->entries[hash & (DIFF_CACHE_BUCKETS - 1)];
+	if (entry->data == NULL || entry->hash != hash || entry->keyLen != key->len
+			|| memcmp(entry->data, key->data, key->len) != 0) {
+		cache->misses++;
+		return NULL;
+	}
+	cache->hits++;
+	reply->data = entry->data + entry->keyLen;
+	reply->len = entry->replyLen;
+	reply->cap = 0;
+	return reply;
+}
+
+void diff_cache_insert(diff_cache_t* cache, msg_seq_t* key, uint64_t hash, msg_seq_t* reply) {
+	diff_cache_entry_t* entry = &cache->entries[hash & (DIFF_CACHE_BUCKETS - 1)];
+	free(entry->data);
+	entry->hash = hash;
+	entry->keyLen = key->len;
+	entry->replyLen = reply->len;
+	entry->data = malloc(key->len + reply->len);
+	memcpy(entry->data, key->data, key->len);
+	memcpy(entry->data + key->len, reply->data, reply->len);
+}
+
+void diff_cache_destroy(diff_cache_t* cache) {
+	for (int i = 0; i < DIFF_CACHE_BUCKETS; i++) {
+		free(cache->entries[i].data);
+	}
+	free(cache->entries);
+}
+
+// Sent by a child ahead of each block. A child that only sends numInstrs
+// gets QOS_DEFAULT and no execution count.
+typedef struct {
+	int numInstrs;
+	int qos;
+	uint64_t execCount;
+	int flags;
+	int numProfiles;
+} block_header_t;
+
+#define QOS_BATCH 0
+#define QOS_DEFAULT 1
+#define QOS_LATENCY 2
+
+// Acked instead of numInstrs to tell the child to keep its block unchanged
+#define BLOCK_SHED -2
+
+// Set in flags when the header starts a hint: a block the child just built
+// that may later be part of a trace. The instruction messages follow the
+// header in the same packet, framed as in a capture file, and nothing is
+// acked. HINT_LOOP marks blocks that end in a backward branch: DR makes
+// its target a trace head, so the block is very likely in that trace.
+#define BLOCK_HINT 1
+#define HINT_LOOP 2
+// Largest packet a child sends; also the most a pipe write does atomically
+#define HINT_MAX_SIZE 4096
+
+// Set in flags when numProfiles branch_profile_t follow the header in the
+// same packet: how often forward conditional branches in the block went
+// each way while the child sampled them, and how often indirect jmps and
+// calls went to their most common target, scaled to add up to
+// BRANCH_PROFILE_SCALE. They are part of the block as far as the diff
+// cache and captures are concerned.
+#define BLOCK_PROFILE 4
+#define MAX_BRANCH_PROFILES 16
+#define BRANCH_PROFILE_SCALE 16
+
+typedef struct {
+	int index;
+	int taken;
+	int notTaken;
+	int reserved;
+	// Indirect branches only
+	uint64_t target;
+} branch_profile_t;
+
+// Set in flags when numInstrs instr_summary_t follow the profiles in the
+// same packet. Instead of numInstrs, the parent then acks with the ranges
+// of instructions it wants in full, as a count and that many
+// block_range_t, and the child sends only those. No ranges means the block
+// stays as it is.
+#define BLOCK_SUMMARY 8
+#define SUMMARY_MAX_INSTRS (HINT_MAX_SIZE / (int) sizeof(instr_summary_t))
+
+typedef struct {
+	unsigned char* app_pc;
+	int opcode;
+	int length;
+} instr_summary_t;
+
+typedef struct {
+	int start;
+	int count;
+} block_range_t;
+
+// Picks the instructions of a summarized block worth sending in full: the
+// ones whose opcodes are in the table. The rest would only be barriers to
+// every pass, operands or not, so they stand in as unknown instructions.
+// Returns how many ranges were written to ranges, or 0 if nothing but
+// unprofiled branches is left, which no pass changes.
+int summary_select_ranges(instr_summary_t* summary, int numInstrs, branch_profile_t* profiles, int numProfiles,
+		block_range_t* ranges) {
+	int numRanges = 0;
+	int useful = 0;
+	for (int j = 0; j < numInstrs; j++) {
+		const opcode_info_t* info = opcode_info(summary[j].opcode);
+		if (!(info->props & OPI_KNOWN)) continue;
+		if (!(info->props & OPI_CTI)) useful = 1;
+		for (int p = 0; p < numProfiles; p++) useful |= profiles[p].index == j;
+		if (numRanges > 0 && ranges[numRanges - 1].start + ranges[numRanges - 1].count == j) {
+			ranges[numRanges - 1].count++;
+		} else {
+			ranges[numRanges].start = j;
+			ranges[numRanges].count = 1;
+			numRanges++;
+		}
+	}
+	return useful ? numRanges : 0;
+}
+
+// Hands each profile to the branch at its position in bb
+void instrlist_apply_profiles(instrlist_t* bb, branch_profile_t* profiles, int numProfiles) {
+	for (int p = 0; p < numProfiles; p++) {
+		instr_t* instr = instrlist_first_app(bb);
+		for (int j = 0; instr != NULL && j < profiles[p].index; j++) instr = instr_get_next_app(instr);
+		if (instr == NULL || profiles[p].taken < 0 || profiles[p].notTaken < 0) continue;
+		int branch = opcode_info(instr_get_opcode(instr))->branch;
+		if (branch == BR_JMP_IND || branch == BR_CALL_IND) {
+			if (profiles[p].target == 0) continue;
+			instr->hotTarget = (unsigned char*) profiles[p].target;
+		} else if (!instr_is_cond_branch(instr) || profiles[p].target != 0) {
+			continue;
+		}
+		instr->taken = profiles[p].taken;
+		instr->notTaken = profiles[p].notTaken;
+	}
+}
+
+// Hints waiting to be optimized speculatively, newest first. When full,
+// the oldest is dropped.
+#define SPEC_QUEUE_SIZE 256
+
+typedef struct {
+	unsigned char* data;
+	size_t len;
+	int numInstrs;
+} spec_block_t;
+
+typedef struct {
+	spec_block_t entries[SPEC_QUEUE_SIZE];
+	int first;
+	int count;
+} spec_queue_t;
+
+void spec_queue_push(spec_queue_t* queue, unsigned char* data, size_t len, int numInstrs) {
+	if (queue->count == SPEC_QUEUE_SIZE) {
+		free(queue->entries[queue->first].data);
+		queue->first = (queue->first + 1) % SPEC_QUEUE_SIZE;
+		queue->count--;
+	}
+	spec_block_t* block = &queue->entries[(queue->first + queue->count++) % SPEC_QUEUE_SIZE];
+	block->data = malloc(len);
+	memcpy(block->data, data, len);
+	block->len = len;
+	block->numInstrs = numInstrs;
+}
+
+// Takes the newest hint; the caller frees out->data. Returns 0 if empty.
+int spec_queue_pop(spec_queue_t* queue, spec_block_t* out) {
+	if (queue->count == 0) return 0;
+	*out = queue->entries[(queue->first + --queue->count) % SPEC_QUEUE_SIZE];
+	return 1;
+}
+
+void spec_queue_destroy(spec_queue_t* queue) {
+	spec_block_t block;
+	while (spec_queue_pop(queue, &block)) {
+		free(block.data);
+	}
+}
+
+// A waiting block's priority level is its QoS class, then how hot it is
+// (log2 of the execution count hint), and goes up one level for every
+// PRIORITY_AGING_NS it has waited so that nothing starves. Every request
+// ages at the same rate, so level * PRIORITY_AGING_NS - arrival time
+// orders them correctly for as long as they wait and a plain heap works.
+#define PRIORITY_HOTNESS_LEVELS 32
+#define PRIORITY_AGING_NS 2000000
+// Once this many blocks are waiting, new ones below SHED_MAX_LEVEL are
+// answered "no change" straight away: batch work, and cold default work
+#define SHED_QUEUE_DEPTH 8
+#define SHED_MAX_LEVEL (QOS_DEFAULT * PRIORITY_HOTNESS_LEVELS + 8)
+
+typedef struct {
+	int readFd;
+	int writeFd;
+	int id;
+	int queued;
+} client_t;
+
+typedef struct {
+	client_t* client;
+	block_header_t header;
+	branch_profile_t profiles[MAX_BRANCH_PROFILES];
+	// Owned copy of the summary, or NULL if the block comes whole
+	instr_summary_t* summary;
+	// Hash of the summary and profiles, the same for identical requests
+	// from different children; 0 without a summary
+	uint64_t fingerprint;
+	int64_t key;
+} pending_block_t;
+
+typedef struct {
+	pending_block_t* heap;
+	int size;
+	int cap;
+} block_queue_t;
+
+int block_priority_level(block_header_t* header) {
+	int qos = header->qos < QOS_BATCH ? QOS_BATCH : header->qos > QOS_LATENCY ? QOS_LATENCY : header->qos;
+	int hotness = header->execCount == 0 ? 0 : 64 - __builtin_clzll(header->execCount);
+	if (hotness >= PRIORITY_HOTNESS_LEVELS) hotness = PRIORITY_HOTNESS_LEVELS - 1;
+	return qos * PRIORITY_HOTNESS_LEVELS + hotness;
+}
+
+void block_queue_push(block_queue_t* queue, pending_block_t* block) {
+	if (queue->size == queue->cap) {
+		queue->cap = queue->cap == 0 ? 16 : 2 * queue->cap;
+		queue->heap = realloc(queue->heap, queue->cap * sizeof(pending_block_t));
+	}
+	int i = queue->size++;
+	while (i > 0 && queue->heap[(i - 1) / 2].key < block->key) {
+		queue->heap[i] = queue->heap[(i - 1) / 2];
+		i = (i - 1) / 2;
+	}
+	queue->heap[i] = *block;
+}
+
+// Raises the priority of the block at index i to key; returns its new index
+int block_queue_raise(block_queue_t* queue, int i, int64_t key) {
+	pending_block_t block = queue->heap[i];
+	block.key = key;
+	while (i > 0 && queue->heap[(i - 1) / 2].key < key) {
+		queue->heap[i] = queue->heap[(i - 1) / 2];
+		i = (i - 1) / 2;
+	}
+	queue->heap[i] = block;
+	return i;
+}
+
+// Index of a waiting block with the given fingerprint, or -1
+int block_queue_find(block_queue_t* queue, uint64_t fingerprint) {
+	for (int i = 0; i < queue->size; i++) {
+		if (queue->heap[i].fingerprint == fingerprint) return i;
+	}
+	return -1;
+}
+
+// Removes the highest priority block into out; returns 0 if there is none
+int block_queue_pop(block_queue_t* queue, pending_block_t* out) {
+	if (queue->size == 0) return 0;
+	*out = queue->heap[0];
+	pending_block_t last = queue->heap[--queue->size];
+	int i = 0;
+	while (2 * i + 1 < queue->size) {
+		int child = 2 * i + 1;
+		if (child + 1 < queue->size && queue->heap[child + 1].key > queue->heap[child].key) child++;
+		if (queue->heap[child].key <= last.key) break;
+		queue->heap[i] = queue->heap[child];
+		i = child;
+	}
+	queue->heap[i] = last;
+	return 1;
+}
+
+// The diff cache can be saved to a file and loaded back by a later run. A
+// cache made with different passes or for a different microarchitecture is
+// ignored, since its diffs are not what this optimizer would produce.
+#define DIFF_CACHE_MAGIC 0x43414344
+#define DIFF_CACHE_VERSION 1
+
+typedef struct {
+	uint32_t magic;
+	uint32_t version;
+	uint64_t signature;
+	uint64_t numEntries;
+} diff_cache_file_header_t;
+
+typedef struct {
+	uint64_t hash;
+	uint32_t keyLen;
+	uint32_t replyLen;
+} diff_cache_file_entry_t;
+
+// Writes the cache to path atomically; returns -1 on failure
+int diff_cache_save(diff_cache_t* cache, const char* path) {
+	char tmpPath[4096];
+	snprintf(tmpPath, sizeof(tmpPath), "%s.tmp", path);
+	FILE* f = fopen(tmpPath, "wb");
+	if (f == NULL) return -1;
+	diff_cache_file_header_t header = {DIFF_CACHE_MAGIC, DIFF_CACHE_VERSION, optimizer_signature(), 0};
+	for (int i = 0; i < DIFF_CACHE_BUCKETS; i++) {
+		if (cache->entries[i].data != NULL) header.numEntries++;
+	}
+	int ok = fwrite(&header, sizeof(header), 1, f) == 1;
+	for (int i = 0; i < DIFF_CACHE_BUCKETS && ok; i++) {
+		diff_cache_entry_t* entry = &cache->entries[i];
+		if (entry->data == NULL) continue;
+		diff_cache_file_entry_t fileEntry = {entry->hash, entry->keyLen, entry->replyLen};
+		ok = fwrite(&fileEntry, sizeof(fileEntry), 1, f) == 1
+			&& fwrite(entry->data, entry->keyLen + entry->replyLen, 1, f) == 1;
+	}
+	if (fclose(f) != 0 || !ok || rename(tmpPath, path) == -1) {
+		unlink(tmpPath);
+		return -1;
+	}
+	return 0;
+}
+
+// Adds the entries saved in path to the cache. Returns how many were
+// loaded, or -1 if the file is missing, damaged or from another optimizer.
+long diff_cache_load(diff_cache_t* cache, const char* path) {
+	FILE* f = fopen(path, "rb");
+	if (f == NULL) return -1;
+	diff_cache_file_header_t header;
+	if (fread(&header, sizeof(header), 1, f) != 1 || header.magic != DIFF_CACHE_MAGIC
+			|| header.version != DIFF_CACHE_VERSION || header.signature != optimizer_signature()) {
+		fclose(f);
+		return -1;
+	}
+	long loaded = 0;
+	diff_cache_file_entry_t fileEntry;
+	while (loaded < (long) header.numEntries && fread(&fileEntry, sizeof(fileEntry), 1, f) == 1) {
+		unsigned char* data = malloc(fileEntry.keyLen + fileEntry.replyLen);
+		if (fread(data, fileEntry.keyLen + fileEntry.replyLen, 1, f) != 1
+				|| hash_bytes(data, fileEntry.keyLen) != fileEntry.hash) {
+			free(data);
+			break;
+		}
+		diff_cache_entry_t* entry = &cache->entries[fileEntry.hash & (DIFF_CACHE_BUCKETS - 1)];
+		free(entry->data);
+		entry->hash = fileEntry.hash;
+		entry->keyLen = fileEntry.keyLen;
+		entry->replyLen = fileEntry.replyLen;
+		entry->data = data;
+		loaded++;
+	}
+	fclose(f);
+	return loaded;
+}
+
+// State shared by every child or client the optimizer serves
+typedef struct {
+	unsigned char* buf;
+	msg_arena_t arena;
+	msg_seq_t key;
+	msg_seq_t reply;
+	diff_cache_t cache;
+	capture_t* capture;
+	block_queue_t queue;
+	long shed;
+	long coalesced;
+	spec_queue_t specLoops;
+	spec_queue_t specOthers;
+	long speculated;
+} server_t;
+
+void server_init(server_t* server, capture_t* capture) {
+	server->buf = malloc(HINT_MAX_SIZE);
+	msg_arena_init(&server->arena);
+	memset(&server->key, 0, sizeof(msg_seq_t));
+	memset(&server->reply, 0, sizeof(msg_seq_t));
+	diff_cache_init(&server->cache);
+	server->capture = capture;
+	memset(&server->queue, 0, sizeof(block_queue_t));
+	server->shed = 0;
+	server->coalesced = 0;
+	memset(&server->specLoops, 0, sizeof(spec_queue_t));
+	memset(&server->specOthers, 0, sizeof(spec_queue_t));
+	server->speculated = 0;
+}
+
+void server_destroy(server_t* server) {
+	free(server->buf);
+	msg_arena_destroy(&server->arena);
+	free(server->key.data);
+	free(server->reply.data);
+	diff_cache_destroy(&server->cache);
+	free(server->queue.heap);
+	spec_queue_destroy(&server->specLoops);
+	spec_queue_destroy(&server->specOthers);
+	if (server->capture != NULL) capture_close(server->capture);
+}
+
+void server_load_cache(server_t* server, const char* path) {
+	if (path == NULL) return;
+	long loaded = diff_cache_load(&server->cache, path);
+	if (loaded >= 0) printf("diff cache: loaded %ld entries from %s\n", loaded, path);
+}
+
+void server_save_cache(server_t* server, const char* path) {
+	if (path != NULL && diff_cache_save(&server->cache, path) == -1) {
+		printf("Error saving diff cache to %s\n", path);
+	}
+}
+
+// Optimizes bb, whose received messages are key, and caches the reply
+msg_seq_t* server_optimize_block(server_t* server, instrlist_t* bb, msg_seq_t* key, uint64_t hash) {
+	unsigned char* buf = server->buf;
+	optimize(bb);
+	msg_seq_t* reply = &server->reply;
+	reply->len = 0;
+	for (instr_t* toSend = instrlist_first_app(bb); toSend != NULL; toSend = instr_get_next_app(toSend)) {
+		msg_seq_append(reply, buf, encode_instr_reply(toSend, buf));
+	}
+	msg_seq_append(reply, buf, writeIntToBuf(buf, -1) - buf);
+	msg_seq_append(reply, buf, writePtrToBuf(buf, bb->fall_through) - buf);
+	diff_cache_insert(&server->cache, key, hash, reply);
+	return reply;
+}
+
+// Receives the rest of a block whose numInstrs was just read into
+// server->buf, optimizes it and sends back the diff. If the child sent a
+// summary, only the instructions picked from it are received; the others
+// are filled in as unknown ones. Returns -1 if the child went away part
+// way through.
+int serve_block(server_t* server, int childId, int readFd, int writeFd, int numInstrs,
+		branch_profile_t* profiles, int numProfiles, instr_summary_t* summary) {
+	unsigned char* buf = server->buf;
+	capture_t* capture = server->capture;
+	block_range_t ranges[SUMMARY_MAX_INSTRS];
+	int numRanges = 0;
+	int ackLen = sizeof(int);
+	if (summary != NULL) {
+		numRanges = summary_select_ranges(summary, numInstrs, profiles, numProfiles, ranges);
+		writeIntToBuf(buf, numRanges);
+		memcpy(buf + sizeof(int), ranges, numRanges * sizeof(block_range_t));
+		ackLen += numRanges * sizeof(block_range_t);
+	}
+	if (write(writeFd, buf, ackLen) == -1) return -1;
+	// The child keeps the block as it is
+	if (summary != NULL && numRanges == 0) return 0;
+	if (capture != NULL) capture_begin_record(capture, childId, numInstrs, numProfiles);
+	server->key.len = 0;
+	instrlist_t* bb = instrlist_create();
+	int gone = 0;
+	int range = 0;
+	for (int j = 0; j < numInstrs && !gone; j++) {
+		unsigned char* msg;
+		int msgLen;
+		int sent = summary == NULL || (range < numRanges && j >= ranges[range].start);
+		if (sent) {
+			// Read straight into the arena; the instruction is a view over it
+			msg = msg_arena_reserve(&server->arena, MSG_BUF_SIZE);
+			msgLen = busy_read_loop(readFd, msg, MSG_BUF_SIZE);
+			if (msgLen == 0) {
+				gone = 1;
+				break;
+			}
+			if (summary != NULL && j == ranges[range].start + ranges[range].count - 1) range++;
+		} else {
+			// Exactly what the child would have sent for an instruction with
+			// an opcode nothing knows, so captures replay as usual
+			msg = msg_arena_reserve(&server->arena, sizeof(instr_data_t));
+			instr_data_t* unknown = (instr_data_t*) msg;
+			unknown->app_pc = summary[j].app_pc;
+			unknown->opcode = OP_INVALID;
+			unknown->numSrc = 0;
+			unknown->numDst = 0;
+			unknown->length = summary[j].length;
+			msgLen = sizeof(instr_data_t);
+		}
+		msg_arena_commit(&server->arena, msgLen);
+		msg_seq_append(&server->key, msg, msgLen);
+		if (capture != NULL) capture_append_msg(capture, msg, msgLen);
+		instr_t* newInst = instr_create_view((instr_data_t*) msg);
+		newInst->origIndex = j;
+		instrlist_append(bb, newInst);
+		if (sent && write(writeFd, buf, sizeof(int)) == -1) gone = 1;
+	}
+	if (!gone && busy_read_loop(readFd, buf, sizeof(int)) == 0) gone = 1;
+	if (!gone && numProfiles > 0) {
+		instrlist_apply_profiles(bb, profiles, numProfiles);
+		msg_seq_append(&server->key, (unsigned char*) profiles, numProfiles * sizeof(branch_profile_t));
+		if (capture != NULL) capture_append_msg(capture, (unsigned char*) profiles, numProfiles * sizeof(branch_profile_t));
+	}
+	msg_seq_t cached;
+	msg_seq_t* reply = NULL;
+	uint64_t hash = hash_bytes(server->key.data, server->key.len);
+	if (!gone) reply = diff_cache_lookup(&server->cache, &server->key, hash, &cached);
+	if (!gone && reply == NULL) reply = server_optimize_block(server, bb, &server->key, hash);
+	instrlist_destroy(bb);
+	msg_arena_reset(&server->arena);
+	// Every reply message but the fall-through target is acked by the child
+	for (size_t offset = 0; !gone && offset < reply->len; ) {
+		capture_msg_t* msg = (capture_msg_t*) (reply->data + offset);
+		offset = (unsigned char*) capture_msg_next(msg) - reply->data;
+		if (write(writeFd, msg + 1, msg->length) == -1) gone = 1;
+		if (capture != NULL) capture_append_msg(capture, (unsigned char*) (msg + 1), msg->length);
+		if (!gone && offset < reply->len && busy_read_loop(readFd, buf, sizeof(int)) == 0) gone = 1;
+	}
+	if (capture != NULL) {
+		if (gone) {
+			capture_abort_record(capture);
+		} else {
+			capture_end_record(capture);
+		}
+	}
+	return gone ? -1 : 0;
+}
+
+// Sends the client the int at the start of server->buf; returns -1 if the
+// client has gone away
+static int server_ack(server_t* server, client_t* client) {
+	return write(client->writeFd, server->buf, sizeof(int)) == sizeof(int) ? 0 : -1;
+}
+
+// Handles the header a client just sent (bytesRead bytes in server->buf):
+// queues the block, or sheds it if the optimizer is overloaded. Returns -1
+// if the client is saying goodbye instead, or has gone away.
+int server_receive_header(server_t* server, client_t* client, int bytesRead) {
+	block_header_t header = {0, QOS_DEFAULT, 0};
+	memcpy(&header, server->buf, bytesRead < (int) sizeof(header) ? bytesRead : (int) sizeof(header));
+	if (header.numInstrs == -1) {
+		// It is detached whether or not the ack gets through
+		server_ack(server, client);
+		return -1;
+	}
+	if (header.flags & BLOCK_HINT) {
+		if (bytesRead > (int) sizeof(header) && header.numInstrs > 0) {
+			spec_queue_t* queue = (header.flags & HINT_LOOP) ? &server->specLoops : &server->specOthers;
+			spec_queue_push(queue, server->buf + sizeof(header), bytesRead - sizeof(header), header.numInstrs);
+		}
+		return 0;
+	}
+	int level = block_priority_level(&header);
+	// A summary that did not arrive whole can't be answered with ranges, so
+	// that block is shed too
+	int summaryOffset = sizeof(header) + header.numProfiles * sizeof(branch_profile_t);
+	int badSummary = (header.flags & BLOCK_SUMMARY) && (header.numInstrs <= 0 || header.numInstrs > SUMMARY_MAX_INSTRS ||
+		header.numProfiles < 0 || header.numProfiles > MAX_BRANCH_PROFILES ||
+		bytesRead < summaryOffset + header.numInstrs * (int) sizeof(instr_summary_t));
+	// Children running the same program ask for the same traces at about the
+	// same time. A request identical to a waiting one joins it: it is served
+	// straight after, from the diff cache entry the first one leaves, so it
+	// costs no optimizer time and is never shed.
+	uint64_t fingerprint = 0;
+	int leader = -1;
+	if ((header.flags & BLOCK_SUMMARY) && !badSummary) {
+		int len = summaryOffset - sizeof(header) + header.numInstrs * sizeof(instr_summary_t);
+		fingerprint = (hash_bytes(server->buf + sizeof(header), len) ^ header.numProfiles) | 1;
+		leader = block_queue_find(&server->queue, fingerprint);
+	}
+	if (badSummary || (leader == -1 && server->queue.size >= SHED_QUEUE_DEPTH && level < SHED_MAX_LEVEL)) {
+		writeIntToBuf(server->buf, BLOCK_SHED);
+		server->shed++;
+		return server_ack(server, client);
+	}
+	pending_block_t block;
+	block.client = client;
+	block.header = header;
+	block.header.numProfiles = 0;
+	block.summary = NULL;
+	if (header.flags & BLOCK_SUMMARY) {
+		block.summary = malloc(header.numInstrs * sizeof(instr_summary_t));
+		memcpy(block.summary, server->buf + summaryOffset, header.numInstrs * sizeof(instr_summary_t));
+	}
+	if (header.flags & BLOCK_PROFILE) {
+		int available = (bytesRead - (int) sizeof(header)) / (int) sizeof(branch_profile_t);
+		int numProfiles = header.numProfiles;
+		if (numProfiles > available) numProfiles = available;
+		if (numProfiles > MAX_BRANCH_PROFILES) numProfiles = MAX_BRANCH_PROFILES;
+		if (numProfiles > 0) {
+			memcpy(block.profiles, server->buf + sizeof(header), numProfiles * sizeof(branch_profile_t));
+			block.header.numProfiles = numProfiles;
+		}
+	}
+	block.fingerprint = fingerprint;
+	block.key = (int64_t) level * PRIORITY_AGING_NS - (int64_t) time_now_ns(CLOCK_MONOTONIC);
+	if (leader != -1) {
+		// The shared job goes at the priority of its most urgent requester
+		if (block.key > server->queue.heap[leader].key) leader = block_queue_raise(&server->queue, leader, block.key);
+		block.key = server->queue.heap[leader].key - 1;
+		server->coalesced++;
+	}
+	block_queue_push(&server->queue, &block);
+	client->queued = 1;
+	return 0;
+}
+
+// Serves the highest priority waiting block and returns its client, or
+// NULL if nothing is waiting. *gone is set if the client went away.
+client_t* server_serve_next(server_t* server, int* gone) {
+	pending_block_t block;
+	if (!block_queue_pop(&server->queue, &block)) return NULL;
+	block.client->queued = 0;
+	writeIntToBuf(server->buf, block.header.numInstrs);
+	*gone = serve_block(server, block.client->id, block.client->readFd, block.client->writeFd, block.header.numInstrs,
+		block.profiles, block.header.numProfiles, block.summary) == -1;
+	free(block.summary);
+	return block.client;
+}
+
+// Optimizes a hinted block (its framed instruction messages) into the diff
+// cache unless it is already there. Returns 1 if it was optimized.
+int server_optimize_hint(server_t* server, unsigned char* data, size_t len, int numInstrs) {
+	msg_seq_t key = {data, len, len};
+	uint64_t hash = hash_bytes(key.data, key.len);
+	diff_cache_entry_t* entry = &server->cache.entries[hash & (DIFF_CACHE_BUCKETS - 1)];
+	if (entry->data != NULL && entry->hash == hash) return 0;
+	// Decode in place, checking the framing since nothing was acked
+	instrlist_t* bb = instrlist_create();
+	unsigned char* end = data + len;
+	capture_msg_t* msg = (capture_msg_t*) data;
+	int j;
+	for (j = 0; j < numInstrs; j++) {
+		if ((unsigned char*) (msg + 1) > end || msg->length < sizeof(instr_data_t)
+				|| (unsigned char*) (msg + 1) + msg->length > end) {
+			break;
+		}
+		instr_t* newInst = instr_create_view((instr_data_t*) (msg + 1));
+		newInst->origIndex = j;
+		instrlist_append(bb, newInst);
+		msg = capture_msg_next(msg);
+	}
+	int optimized = j == numInstrs && (unsigned char*) msg == end;
+	if (optimized) server_optimize_block(server, bb, &key, hash);
+	instrlist_destroy(bb);
+	return optimized;
+}
+
+// Optimizes one hinted block into the diff cache, so that the request for
+// the trace it ends up in is a hit. Only called when no child is waiting.
+// Returns 0 if there was nothing to do.
+int server_speculate(server_t* server) {
+	spec_block_t block;
+	if (!spec_queue_pop(&server->specLoops, &block) && !spec_queue_pop(&server->specOthers, &block)) {
+		return 0;
+	}
+	server->speculated += server_optimize_hint(server, block.data, block.len, block.numInstrs);
+	free(block.data);
+	return 1;
+}
+
+// Runs aotScan over an ELF binary and optimizes every loop it finds into
+// the diff cache, so the first run of the binary already hits. The scanner
+// writes one hint per loop block to a packet-mode pipe.
+int run_aot(server_t* server, const char* elfPath, const char* loadBase) {
+	int scanPipe[2];
+	if (pipe2(scanPipe, O_DIRECT) == -1) {
+		printf("Error making pipe.\n");
+		return 1;
+	}
+	int pid = fork();
+	if (pid == -1) {
+		printf("Error, failed to fork\n");
+		return 1;
+	} else if (pid == 0) {
+		close(scanPipe[0]);
+		dup2(scanPipe[1], STDOUT_FILENO);
+		//Hardcoded file path, like drrun's; change this later
+		const char* scanner = "../rioTools/bin/aotScan";
+		execl(scanner, scanner, elfPath, loadBase, (char *) NULL);
+		printf("Error executing aotScan.\n");
+		exit(1);
+	}
+	close(scanPipe[1]);
+	long loops = 0;
+	long optimized = 0;
+	int bytesRead;
+	while ((bytesRead = read(scanPipe[0], server->buf, HINT_MAX_SIZE)) > 0) {
+		block_header_t header;
+		if (bytesRead <= (int) sizeof(header)) continue;
+		memcpy(&header, server->buf, sizeof(header));
+		if (!(header.flags & BLOCK_HINT) || header.numInstrs <= 0) continue;
+		loops++;
+		optimized += server_optimize_hint(server, server->buf + sizeof(header), bytesRead - sizeof(header), header.numInstrs);
+	}
+	close(scanPipe[0]);
+	int status;
+	waitpid(pid, &status, 0);
+	printf("aot: %ld loop blocks, %ld newly optimized\n", loops, optimized);
+	return !WIFEXITED(status) || WEXITSTATUS(status) != 0;
+}
+
+static volatile sig_atomic_t daemonStopping = 0;
+
+static void daemon_stop(int sig) {
+	daemonStopping = 1;
+}
+
+// Serves clients that connect to a Unix socket at path until SIGINT or
+// SIGTERM. Clients attach and detach at any time; the diff cache and the
+// capture file live as long as the daemon does. SOCK_SEQPACKET keeps the
+// message boundaries the lockstep protocol relies on.
+int run_daemon(server_t* server, const char* path) {
+	struct sockaddr_un addr;
+	memset(&addr, 0, sizeof(addr));
+	addr.sun_family = AF_UNIX;
+	if (strlen(path) >= sizeof(addr.sun_path)) {
+		printf("Error: socket path too long\n");
+		return 1;
+	}
+	strcpy(addr.sun_path, path);
+	int listenFd = socket(AF_UNIX, SOCK_SEQPACKET, 0);
+	unlink(path);
+	if (listenFd == -1 || bind(listenFd, (struct sockaddr*) &addr, sizeof(addr)) == -1 || listen(listenFd, 64) == -1) {
+		printf("Error listening on %s\n", path);
+		return 1;
+	}
+	// A client that disconnects mid-write must not take the daemon down
+	signal(SIGPIPE, SIG_IGN);
+	struct sigaction sa;
+	memset(&sa, 0, sizeof(sa));
+	sa.sa_handler = daemon_stop;
+	sigaction(SIGINT, &sa, NULL);
+	sigaction(SIGTERM, &sa, NULL);
+	int maxClients = 64;
+	int numClients = 0;
+	client_t** clients = malloc(maxClients * sizeof(client_t*));
+	struct pollfd* fds = malloc((maxClients + 1) * sizeof(struct pollfd));
+	int nextClientId = 0;
+	while (!daemonStopping) {
+		// Clients with a queued block are waiting on us, so only poll the rest
+		fds[0].fd = listenFd;
+		fds[0].events = POLLIN;
+		for (int i = 0; i < numClients; i++) {
+			fds[i + 1].fd = clients[i]->queued ? -1 : clients[i]->readFd;
+			fds[i + 1].events = POLLIN;
+			fds[i + 1].revents = 0;
+		}
+		int busy = server->queue.size > 0 || server->specLoops.count > 0 || server->specOthers.count > 0;
+		if (poll(fds, numClients + 1, busy ? 0 : -1) == -1) {
+			if (errno == EINTR) continue;
+			printf("Error: poll failed\n");
+			break;
+		}
+		for (int i = numClients - 1; i >= 0; i--) {
+			if (fds[i + 1].revents == 0) continue;
+			int bytesRead = read(clients[i]->readFd, server->buf, HINT_MAX_SIZE);
+			if (bytesRead == -1 && (errno == EAGAIN || errno == EWOULDBLOCK)) continue;
+			if (bytesRead <= 0 || server_receive_header(server, clients[i], bytesRead) == -1) {
+				close(clients[i]->readFd);
+				free(clients[i]);
+				clients[i] = clients[--numClients];
+			}
+		}
+		if (fds[0].revents & POLLIN) {
+			int fd = accept4(listenFd, NULL, NULL, SOCK_NONBLOCK);
+			if (fd != -1) {
+				if (numClients == maxClients) {
+					maxClients *= 2;
+					clients = realloc(clients, maxClients * sizeof(client_t*));
+					fds = realloc(fds, (maxClients + 1) * sizeof(struct pollfd));
+				}
+				client_t* client = malloc(sizeof(client_t));
+				client->readFd = fd;
+				client->writeFd = fd;
+				client->id = nextClientId++;
+				client->queued = 0;
+				clients[numClients++] = client;
+			}
+		}
+		int gone = 0;
+		client_t* served = server_serve_next(server, &gone);
+		if (served == NULL) server_speculate(server);
+		if (served != NULL && gone) {
+			for (int i = 0; i < numClients; i++) {
+				if (clients[i] != served) continue;
+				close(served->readFd);
+				free(served);
+				clients[i] = clients[--numClients];
+				break;
+			}
+		}
+	}
+	for (int i = 0; i < numClients; i++) {
+		close(clients[i]->readFd);
+		free(clients[i]);
+	}
+	close(listenFd);
+	unlink(path);
+	free(clients);
+	free(fds);
+	printf("diff cache: %ld hits, %ld misses; %ld blocks shed, %ld optimized speculatively\n",
+		server->cache.hits, server->cache.misses, server->shed, server->speculated);
+	return 0;
+}
+
+int main(int argc, char** argv) {
+	if (argc >= 3 && strcmp(argv[1], "--replay") == 0) {
+		int numThreads = 1;
+		int iterations = 1;
+		const char* uarch = NULL;
+		for (int i = 3; i + 1 < argc; i += 2) {
+			if (strcmp(argv[i], "--threads") == 0) {
+				numThreads = atoi(argv[i + 1]);
+			} else if (strcmp(argv[i], "--iterations") == 0) {
+				iterations = atoi(argv[i + 1]);
+			} else if (strcmp(argv[i], "--uarch") == 0) {
+				uarch = argv[i + 1];
+			}
+		}
+		if (!select_uarch(uarch)) return 1;
+		numa_detect(&numaTopology);
+		return replay_capture(argv[2], numThreads < 1 ? 1 : numThreads, iterations < 1 ? 1 : iterations);
+	}
+	capture_t captureFile;
+	capture_t* capture = NULL;
+	const char* socketPath = NULL;
+	const char* cachePath = NULL;
+	const char* aotPath = NULL;
+	const char* uarch = NULL;
+	while (argc >= 3 && strncmp(argv[1], "--", 2) == 0) {
+		if (strcmp(argv[1], "--record") == 0) {
+			if (capture_open(&captureFile, argv[2]) == -1) {
+				printf("Error opening capture file %s\n", argv[2]);
+				return 1;
+			}
+			capture = &captureFile;
+		} else if (strcmp(argv[1], "--daemon") == 0) {
+			socketPath = argv[2];
+		} else if (strcmp(argv[1], "--cache") == 0) {
+			cachePath = argv[2];
+		} else if (strcmp(argv[1], "--aot") == 0) {
+			aotPath = argv[2];
+		} else if (strcmp(argv[1], "--uarch") == 0) {
+			uarch = argv[2];
+		} else {
+			break;
+		}
+		argv += 2;
+		argc -= 2;
+	}
+	// Before anything hashes the optimizer signature
+	if (!select_uarch(uarch)) return 1;
+	// Before anything is allocated, and before the children are forked
+	numa_detect(&numaTopology);
+	int serverNode = numa_bind_here(&numaTopology);
+	if (serverNode != -1) printf("NUMA: %d nodes; optimizing on node %d\n", numaTopology.numNodes, serverNode);
+	server_t server;
+	if (socketPath != NULL || aotPath != NULL) {
+		server_init(&server, capture);
+		server_load_cache(&server, cachePath);
+		int ret = socketPath != NULL ? run_daemon(&server, socketPath) : run_aot(&server, aotPath, argc > 1 ? argv[1] : NULL);
+		server_save_cache(&server, cachePath);
+		server_destroy(&server);
+		return ret;
+	}
+	if (argc < 4) {
+		printf("Usage: parent [--record <capture>] [--cache <file>] [--uarch <name>] <drrun location> <client location> <programs>\n");
+		printf("       parent [--record <capture>] [--cache <file>] [--uarch <name>] --daemon <socket>\n");
+		printf("       parent --cache <file> [--uarch <name>] --aot <elf> [load base]\n");
+		printf("       parent --replay <capture> [--threads <n>] [--iterations <n>] [--uarch <name>]\n");
+		printf("Microarchitectures: skylake, zen2, netburst (default: the host CPU's)\n");
+		return 0;
+	}
+	//Hardcoded file paths; change these later
+	argv[1] = "../DynamoRIO-Linux-9.0.0/bin64/drrun";
+	argv[2] = "../rioTools/bin/libchildProgramClient.so";
+	int numChildren = argc - 3;
+	int* childReadPipes = malloc(numChildren * sizeof(int));
+	int* childWritePipes = malloc(numChildren * sizeof(int));
+	for (int i = 3; i < argc; i++) {
+		int pipeToChild[2];
+		int pipeToParent[2];
+		if (pipe(pipeToChild) == -1) {
+			printf("Error making pipe.\n");
+			return 1;
+		}
+		// Packet mode, so every write from the child is read back whole and
+		// alone, even fire-and-forget hints sent back to back
+		if (pipe2(pipeToParent, O_NONBLOCK | O_DIRECT) == -1) {
+			printf("Error making pipe 2.\n");
+			return 1;
+		}
+		int pid = fork();
+		if (pid == -1) {
+			printf("Error, failed to fork\n");
+		} else if (pid > 0) {
+			//Do parent stuff
+			close(pipeToChild[0]);
+			close(pipeToParent[1]);
+			childReadPipes[i-3] = pipeToParent[0];
+			childWritePipes[i-3] = pipeToChild[1];
+		} else {
+			//Child
+			close(pipeToChild[1]);
+			close(pipeToParent[0]);
+			char pipeWriteBuf[10];
+			char pipeReadBuf[10];
+			sprintf(pipeReadBuf, "%d", pipeToChild[0]);
+			sprintf(pipeWriteBuf, "%d", pipeToParent[1]);
+			// Children past what the server's node can hold next to it go
+			// back to running anywhere
+			if (serverNode != -1 && i - 3 >= CPU_COUNT(&numaTopology.cpus[serverNode]) - 1) {
+				sched_setaffinity(0, sizeof(cpu_set_t), &numaTopology.all);
+			}
+			execl(argv[1], argv[1], "-c", argv[2], pipeReadBuf, pipeWriteBuf, "--", argv[i], (char *) NULL);
+			//Whoops, something went wrong
+			printf("Error executing program.\n");
+			return 1;
+		}
+	}
+	server_init(&server, capture);
+	server_load_cache(&server, cachePath);
+	unsigned char* buf = server.buf;
+	client_t* children = malloc(numChildren * sizeof(client_t));
+	int* isRunning = malloc(numChildren * sizeof(int));
+	int childrenLeft = numChildren;
+	for (int i = 0; i < numChildren; i++) {
+		children[i].readFd = childReadPipes[i];
+		children[i].writeFd = childWritePipes[i];
+		children[i].id = i;
+		children[i].queued = 0;
+		isRunning[i] = 1;
+	}
+	while (childrenLeft > 0) {
+		// Collect every waiting block, then serve the one that matters most
+		for (int i = 0; i < numChildren; i++) {
+			if (!isRunning[i] || children[i].queued) continue;
+			int bytesRead = read(childReadPipes[i], buf, HINT_MAX_SIZE);
+			if (bytesRead == -1) {
+				if ((errno == EAGAIN) || (errno == EWOULDBLOCK)) {
+					continue;
+				} else {
+					printf("Error: read failed\n");
+					return 1;
+				}
+			}
+			// A read of 0 means the child died without saying goodbye
+			if (bytesRead == 0 || server_receive_header(&server, &children[i], bytesRead) == -1) {
+				isRunning[i] = 0;
+				childrenLeft--;
+			}
+		}
+		int gone = 0;
+		client_t* served = server_serve_next(&server, &gone);
+		if (served == NULL) server_speculate(&server);
+		if (served != NULL && gone) {
+			isRunning[served->id] = 0;
+			childrenLeft--;
+		}
+	}
+	server_save_cache(&server, cachePath);
+	server_destroy(&server);
+	free(children);
+	free(isRunning);
+	return 0;
+}
+
+// Replaces the contiguous run nodes[0..n-1] in the list with the same
+// nodes in the given order
+void instrlist_reorder(instrlist_t* ilist, instr_t** nodes, int* order, int n) {
+	instr_t* before = nodes[0]->prev;
+	instr_t* after = nodes[n - 1]->next;
+	instr_t* prev = before;
+	for (int k = 0; k < n; k++) {
+		instr_t* node = nodes[order[k]];
+		node->prev = prev;
+		if (prev == NULL) {
+			ilist->first = node;
+		} else {
+			prev->next = node;
+		}
+		prev = node;
+	}
+	prev->next = after;
+	if (after == NULL) {
+		ilist->last = prev;
+	} else {
+		after->prev = prev;
+	}
+}
+
+/* List scheduling within a trace.
+ * Regions run between control transfers and barriers, which stay put; an
+ * instruction never moves across an exit. Within a region a dependency DAG
+ * over registers, flags and memory is built, and instructions are issued
+ * by critical-path height so long-latency loads and multiplies start early
+ * and their consumers move down. Instructions keep their translations.
+ * Targets of branches within the trace start a new region.
+ */
+#define SCHED_MAX_REGION 256
+#define SCHED_MAX_TARGETS 16
+#define SCHED_WORDS (SCHED_MAX_REGION / 64)
+#define SCHED_ISSUE_WIDTH 4
+
+typedef struct {
+	instr_t* nodes[SCHED_MAX_REGION];
+	instr_effects_t eff[SCHED_MAX_REGION];
+	uint64_t succ[SCHED_MAX_REGION][SCHED_WORDS];
+	// Subsets of succ: true (read-after-write) dependencies, and those
+	// carried through the flags
+	uint64_t raw[SCHED_MAX_REGION][SCHED_WORDS];
+	uint64_t flagRaw[SCHED_MAX_REGION][SCHED_WORDS];
+	uint64_t scheduled[SCHED_WORDS];
+	int numPreds[SCHED_MAX_REGION];
+	int latency[SCHED_MAX_REGION];
+	int height[SCHED_MAX_REGION];
+	int earliest[SCHED_MAX_REGION];
+	// Flag writers that some reader (or the region's exit) depends on
+	int flagsLive[SCHED_MAX_REGION];
+	// Readers of flags set before the region
+	int readsEntryFlags[SCHED_MAX_REGION];
+	int order[SCHED_MAX_REGION];
+} sched_region_t;
+
+#define SCHED_TEST(m, i) (((m)[(i) / 64] >> ((i) % 64)) & 1)
+#define SCHED_SET(m, i) ((m)[(i) / 64] |= 1ULL << ((i) % 64))
+
+static void sched_add_edge(sched_region_t* r, int from, int to, int isRaw) {
+	if (!SCHED_TEST(r->succ[from], to)) {
+		SCHED_SET(r->succ[from], to);
+		r->numPreds[to]++;
+	}
+	if (isRaw) SCHED_SET(r->raw[from], to);
+}
+
+static void sched_build_dag(sched_region_t* r, int n) {
+	memset(r->succ, 0, sizeof(r->succ));
+	memset(r->raw, 0, sizeof(r->raw));
+	memset(r->flagRaw, 0, sizeof(r->flagRaw));
+	memset(r->numPreds, 0, n * sizeof(int));
+	// Flags are tracked per bit, since inc/dec and friends leave some alone
+	int lastWriter[8];
+	for (int f = 0; f < 8; f++) lastWriter[f] = -1;
+	for (int i = 0; i < n; i++) {
+		r->flagsLive[i] = 0;
+		r->readsEntryFlags[i] = 0;
+		for (int f = 0; f < 8; f++) {
+			if (!(r->eff[i].flagsRead & (1 << f))) continue;
+			int w = lastWriter[f];
+			if (w < 0) {
+				r->readsEntryFlags[i] = 1;
+			} else {
+				r->flagsLive[w] = 1;
+				SCHED_SET(r->flagRaw[w], i);
+				sched_add_edge(r, w, i, 1);
+			}
+		}
+		for (int f = 0; f < 8; f++) {
+			if (r->eff[i].flagsWritten & (1 << f)) lastWriter[f] = i;
+		}
+	}
+	// Whatever is in the flags at the end may be read past the exit
+	for (int f = 0; f < 8; f++) {
+		if (lastWriter[f] >= 0) r->flagsLive[lastWriter[f]] = 1;
+	}
+	for (int i = 0; i < n; i++) {
+		instr_effects_t* ei = &r->eff[i];
+		for (int j = 0; j < i; j++) {
+			instr_effects_t* ej = &r->eff[j];
+			int isRaw = (ej->regsWritten & ei->regsRead) != 0 || (ej->writesMem && ei->readsMem);
+			int other = (ej->regsRead & ei->regsWritten) != 0 || (ej->regsWritten & ei->regsWritten) != 0 ||
+				(ej->readsMem && ei->writesMem) || (ej->writesMem && ei->writesMem);
+			if (ei->flagsWritten) {
+				// Live writers stay in order with every earlier flag user;
+				// any writer stays after readers of the incoming flags
+				if (r->flagsLive[i] && (ej->flagsRead || ej->flagsWritten)) other = 1;
+				if (r->readsEntryFlags[j]) other = 1;
+			}
+			if (isRaw || other) sched_add_edge(r, j, i, isRaw);
+		}
+	}
+	// Dead flag writers may float, but only up to the next live writer;
+	// sched_issue keeps them out of live writer-to-reader ranges
+	for (int j = 0; j < n; j++) {
+		if (!r->eff[j].flagsWritten || r->flagsLive[j]) continue;
+		for (int i = j + 1; i < n; i++) {
+			if (r->eff[i].flagsWritten && r->flagsLive[i]) {
+				sched_add_edge(r, j, i, 0);
+				break;
+			}
+		}
+	}
+	for (int i = n - 1; i >= 0; i--) {
+		r->height[i] = r->latency[i];
+		for (int w = 0; w < SCHED_WORDS; w++) {
+			uint64_t bits = r->succ[i][w];
+			while (bits) {
+				int s = w * 64 + __builtin_ctzll(bits);
+				bits &= bits - 1;
+				int edge = SCHED_TEST(r->raw[i], s) ? r->latency[i] : 0;
+				if (edge + r->height[s] > r->height[i]) r->height[i] = edge + r->height[s];
+			}
+		}
+	}
+}
+
+// Whether some issued flag writer still has readers waiting for its value
+static int sched_flags_locked(sched_region_t* r, int n) {
+	for (int i = 0; i < n; i++) {
+		if (!r->flagsLive[i] || !SCHED_TEST(r->scheduled, i)) continue;
+		for (int w = 0; w < SCHED_WORDS; w++) {
+			if (r->flagRaw[i][w] & ~r->scheduled[w]) return 1;
+		}
+	}
+	return 0;
+}
+
+// fuse is the flag writer to keep right before the jcc ending the region,
+// or -1. Returns whether the order changed.
+static int sched_issue(sched_region_t* r, int n, int fuse) {
+	int cycle = 0;
+	int issued = 0;
+	int changed = 0;
+	memset(r->scheduled, 0, sizeof(r->scheduled));
+	for (int i = 0; i < n; i++) {
+		r->earliest[i] = 0;
+	}
+	for (int k = 0; k < n; k++) {
+		int locked = sched_flags_locked(r, n);
+		int best = -1;
+		int fallback = -1;
+		for (int i = 0; i < n; i++) {
+			if (SCHED_TEST(r->scheduled, i) || r->numPreds[i] > 0) continue;
+			if ((r->eff[i].flagsWritten && locked) || (i == fuse && k < n - 1)) {
+				if (fallback == -1 || (fallback == fuse && i != fuse)) fallback = i;
+				continue;
+			}
+			if (best == -1) {
+				best = i;
+				continue;
+			}
+			int readyI = r->earliest[i] <= cycle;
+			int readyBest = r->earliest[best] <= cycle;
+			if (readyI != readyBest) {
+				if (readyI) best = i;
+			} else if (!readyI && r->earliest[i] != r->earliest[best]) {
+				if (r->earliest[i] < r->earliest[best]) best = i;
+			} else if (r->height[i] > r->height[best]) {
+				best = i;
+			}
+		}
+		if (best == -1) {
+			// Everything ready is held back; the earliest in program order
+			// was between its writer and readers originally, so is safe
+			best = fallback;
+		}
+		SCHED_SET(r->scheduled, best);
+		r->order[k] = best;
+		if (best != k) changed = 1;
+		if (r->earliest[best] > cycle) {
+			cycle = r->earliest[best];
+			issued = 0;
+		}
+		if (++issued == SCHED_ISSUE_WIDTH) {
+			cycle++;
+			issued = 0;
+		}
+		for (int w = 0; w < SCHED_WORDS; w++) {
+			uint64_t bits = r->succ[best][w];
+			while (bits) {
+				int s = w * 64 + __builtin_ctzll(bits);
+				bits &= bits - 1;
+				r->numPreds[s]--;
+				int ready = cycle + (SCHED_TEST(r->raw[best], s) ? r->latency[best] : 0);
+				if (ready > r->earliest[s]) r->earliest[s] = ready;
+			}
+		}
+	}
+	return changed;
+}
+
+static int schedule_region(instrlist_t* bb, sched_region_t* r, int n, instr_t* terminator) {
+	if (n < 3) return 0;
+	for (int i = 0; i < n; i++) {
+		instr_get_effects(r->nodes[i], &r->eff[i]);
+		r->latency[i] = instr_latency(r->nodes[i]);
+	}
+	sched_build_dag(r, n);
+	// Keep cmp/test+jcc pairs adjacent so they still macro-fuse
+	int fuse = -1;
+	if (terminator != NULL && instr_is_cond_branch(terminator) &&
+			opcode_has_prop(instr_get_opcode(r->nodes[n - 1]), OPI_MACRO_FUSE)) {
+		fuse = n - 1;
+	}
+	if (!sched_issue(r, n, fuse)) return 0;
+	instrlist_reorder(bb, r->nodes, r->order, n);
+	return 1;
+}
+
+int schedule_trace(instrlist_t* bb) {
+	instr_t* targets[SCHED_MAX_TARGETS];
+	int numTargets = instrlist_get_branch_targets(bb, targets, SCHED_MAX_TARGETS);
+	if (numTargets < 0) return 0;
+	sched_region_t* r = malloc(sizeof(sched_region_t));
+	int changed = 0;
+	int n = 0;
+	instr_t* instr = instrlist_first_app(bb);
+	while (instr != NULL) {
+		instr_t* next = instr_get_next_app(instr);
+		for (int t = 0; t < numTargets; t++) {
+			if (targets[t] == instr) {
+				changed |= schedule_region(bb, r, n, instr);
+				n = 0;
+				break;
+			}
+		}
+		instr_effects_t eff;
+		instr_get_effects(instr, &eff);
+		if (eff.barrier) {
+			changed |= schedule_region(bb, r, n, instr);
+			n = 0;
+		} else {
+			r->nodes[n++] = instr;
+			if (n == SCHED_MAX_REGION) {
+				changed |= schedule_region(bb, r, n, NULL);
+				n = 0;
+			}
+		}
+		instr = next;
+	}
+	changed |= schedule_region(bb, r, n, NULL);
+	free(r);
+	return changed;
+}
+
+/* Traces that are a single loop, for the loop passes below.
+ * The trace must run straight from the loop head to a conditional branch
+ * back to it, with no other exits, so every iteration runs the whole body.
+ * The head is the first instruction, or once a pass has put a preheader in
+ * front of the loop, the instruction the back edge points at.
+ */
+#define LOOP_MAX_BODY 256
+
+typedef struct {
+	// The body in order, then the back edge at nodes[n]
+	instr_t* nodes[LOOP_MAX_BODY + 1];
+	instr_effects_t eff[LOOP_MAX_BODY + 1];
+	int n;
+	int hasStore;
+} loop_t;
+
+static int loop_find(instrlist_t* bb, loop_t* loop) {
+	instr_t* last = instrlist_last_app(bb);
+	if (last == NULL || !instr_is_cond_branch(last)) return 0;
+	instr_t* head = instr_get_branch_target_instr(last);
+	if (head == NULL) {
+		head = instrlist_first_app(bb);
+		if (instr_get_branch_target_pc(last) != instr_get_app_pc(head)) return 0;
+	}
+	if (head == last) return 0;
+	loop->n = 0;
+	loop->hasStore = 0;
+	for (instr_t* instr = head; instr != last; instr = instr_get_next_app(instr)) {
+		if (loop->n == LOOP_MAX_BODY) return 0;
+		instr_effects_t* eff = &loop->eff[loop->n];
+		instr_get_effects(instr, eff);
+		if (eff->barrier) return 0;
+		loop->hasStore |= eff->writesMem;
+		loop->nodes[loop->n++] = instr;
+	}
+	instr_get_effects(last, &loop->eff[loop->n]);
+	loop->nodes[loop->n] = last;
+	return 1;
+}
+
+// Points the back edge at the loop head, now that something is in front of it
+static void loop_set_head(loop_t* loop, instr_t* head) {
+	instr_set_branch_target_instr(loop->nodes[loop->n], head);
+}
+
+/* Loop-invariant code motion.
+ * An instruction whose inputs nothing else in the loop changes (or only
+ * instructions already hoisted ahead of it) computes the same value every
+ * iteration; it is moved to the preheader, so the invariant work runs once
+ * per entry into the trace. Loads are only hoisted out of loops that store
+ * nothing. Hoisted instructions keep their translations.
+ */
+
+// Whether body instruction i may run once before the loop instead of in
+// every iteration
+static int licm_is_invariant(loop_t* loop, uint8_t* hoisted, int i) {
+	instr_effects_t* eff = loop->eff;
+	instr_effects_t* e = &eff[i];
+	int n = loop->n;
+	int opcode = instr_get_opcode(loop->nodes[i]);
+	if (!opcode_has_prop(opcode, OPI_PURE) && opcode != OP_mov_ld) return 0;
+	if (e->writesMem || e->flagsRead || e->regsWritten == 0) return 0;
+	if (e->readsMem && loop->hasStore) return 0;
+	if (e->regsRead & e->regsWritten) return 0;
+	for (int j = 0; j <= n; j++) {
+		if (j == i) continue;
+		// Inputs may only come from instructions hoisted ahead of it
+		if ((eff[j].regsWritten & e->regsRead) && !(j < i && hoisted[j])) return 0;
+		// It must be the only writer, and nothing may read the value the
+		// register had on entry
+		if (eff[j].regsWritten & e->regsWritten) return 0;
+		if (j < i && (eff[j].regsRead & e->regsWritten)) return 0;
+	}
+	if (e->flagsWritten == 0) return 1;
+	// Flags it writes must be dead: not read on entry before another
+	// writer, nor after it before another writer
+	uint8_t live = e->flagsWritten;
+	for (int j = 0; j < i && live; j++) {
+		if (eff[j].flagsRead & live) return 0;
+		live &= ~eff[j].flagsWritten;
+	}
+	live = e->flagsWritten;
+	for (int j = i + 1; j <= n && live; j++) {
+		if (eff[j].flagsRead & live) return 0;
+		live &= ~eff[j].flagsWritten;
+	}
+	// Flags still set by it at the exit are fine if nothing else writes them,
+	// since the hoisted copy leaves the same values
+	for (int j = 0; j < i && live; j++) {
+		if (eff[j].flagsWritten & live) return 0;
+	}
+	return 1;
+}
+
+int licm_trace(instrlist_t* bb) {
+	loop_t* loop = malloc(sizeof(loop_t));
+	if (!loop_find(bb, loop)) {
+		free(loop);
+		return 0;
+	}
+	int n = loop->n;
+	uint8_t hoisted[LOOP_MAX_BODY];
+	int order[LOOP_MAX_BODY + 1];
+	int numHoisted = 0;
+	for (int i = 0; i < n; i++) {
+		hoisted[i] = licm_is_invariant(loop, hoisted, i);
+		if (hoisted[i]) order[numHoisted++] = i;
+	}
+	if (numHoisted == 0 || numHoisted == n) {
+		free(loop);
+		return 0;
+	}
+	int k = numHoisted;
+	instr_t* head = NULL;
+	for (int i = 0; i <= n; i++) {
+		if (i < n && hoisted[i]) continue;
+		if (head == NULL) head = loop->nodes[i];
+		order[k++] = i;
+	}
+	instrlist_reorder(bb, loop->nodes, order, n + 1);
+	loop_set_head(loop, head);
+	free(loop);
+	return 1;
+}
+
+/* Induction variables and strength reduction.
+ * A 64-bit register whose only writes in the loop are add/sub/inc/dec by
+ * an immediate, or lea r, [r + disp], is a linear induction variable that
+ * moves by the sum of those steps each iteration. Unrolled bodies update
+ * it once per copy; those updates are folded into the last one, and the
+ * addresses in between get the missing steps added to their displacements
+ * (any other use in between stops the fold). A multiply of an induction
+ * variable by a constant then becomes an add of the constant times the
+ * step, with the preheader computing the product for the first iteration
+ * less one step.
+ */
+#define IV_NONE INT64_MIN
+
+// How much instr adds to reg, or IV_NONE if it isn't a linear update of reg
+static int64_t iv_step(instr_t* instr, int reg) {
+	instr_opnd_t* src = instr->src;
+	int numSrc = instr->iData->numSrc;
+	if (instr->iData->numDst != 1 || instr->dst[0].type != OPND_REG || instr->dst[0].p1 != reg) return IV_NONE;
+	switch (instr_get_opcode(instr)) {
+	case OP_add:
+	case OP_sub:
+		if (numSrc != 2 || src[0].type != OPND_IMMED_INT || src[1].type != OPND_REG || src[1].p1 != reg) return IV_NONE;
+		return instr_get_opcode(instr) == OP_add ? src[0].p1 : -(int64_t) src[0].p1;
+	case OP_inc:
+	case OP_dec:
+		if (numSrc != 1 || src[0].type != OPND_REG || src[0].p1 != reg) return IV_NONE;
+		return instr_get_opcode(instr) == OP_inc ? 1 : -1;
+	case OP_lea:
+		if (numSrc != 1 || src[0].type != OPND_BASE_DISP || opnd_get_base(&src[0]) != reg ||
+				opnd_get_index(&src[0]) != 0 || opnd_get_segment(&src[0]) != 0) {
+			return IV_NONE;
+		}
+		return src[0].longParam;
+	default:
+		return IV_NONE;
+	}
+}
+
+// Whether every write of GPR gpr in the loop is a linear update of the same
+// 64-bit register; if so, sets that register and its step per iteration
+static int iv_analyze(loop_t* loop, int gpr, int* reg, int64_t* step) {
+	uint64_t bit = 1ULL << gpr;
+	*reg = 0;
+	*step = 0;
+	for (int i = 0; i < loop->n; i++) {
+		if (!(loop->eff[i].regsWritten & bit)) continue;
+		instr_t* instr = loop->nodes[i];
+		if (*reg == 0) {
+			if (instr->iData->numDst < 1 || instr->dst[0].type != OPND_REG) return 0;
+			*reg = instr->dst[0].p1;
+			if (*reg >= REG_TABLE_SIZE || regTable[*reg].size != 8) return 0;
+		}
+		int64_t s = iv_step(instr, *reg);
+		if (s == IV_NONE) return 0;
+		*step += s;
+	}
+	return *reg != 0;
+}
+
+// Whether flags written at body position i are overwritten before anything
+// reads them and before the loop exits, ignoring instructions in skip
+static int loop_flags_dead_after(loop_t* loop, int i, uint8_t flags, uint8_t* skip) {
+	for (int j = i + 1; j <= loop->n && flags; j++) {
+		if (skip != NULL && skip[j]) continue;
+		if (loop->eff[j].flagsRead & flags) return 0;
+		flags &= ~loop->eff[j].flagsWritten;
+	}
+	return flags == 0;
+}
+
+// How much adding offset to GPR gpr moves instr's source addresses, or
+// IV_NONE if it uses the register any other way
+static int64_t iv_address_offset(instr_t* instr, int gpr, int64_t offset, int s) {
+	uint64_t bit = 1ULL << gpr;
+	instr_opnd_t* opnd = &instr->src[s];
+	if (opnd->type == OPND_BASE_DISP) {
+		int64_t adjust = 0;
+		if (reg_mask(opnd_get_base(opnd)) & bit) adjust += offset;
+		if (reg_mask(opnd_get_index(opnd)) & bit) adjust += offset * opnd_get_scale(opnd);
+		return adjust;
+	}
+	if (opnd->type == OPND_REG && (reg_mask(opnd->p1) & bit)) return IV_NONE;
+	return 0;
+}
+
+static int iv_can_offset(instr_t* instr, int gpr, int64_t offset) {
+	uint64_t bit = 1ULL << gpr;
+	if (opcode_info(instr_get_opcode(instr))->regsRead & bit) return 0;
+	// Destinations can't be rewritten, so stores through it stop the fold
+	for (int d = 0; d < instr->iData->numDst; d++) {
+		instr_opnd_t* opnd = &instr->dst[d];
+		if (opnd->type == OPND_REG && (reg_mask(opnd->p1) & bit)) return 0;
+		if (opnd->type == OPND_BASE_DISP &&
+				((reg_mask(opnd_get_base(opnd)) | reg_mask(opnd_get_index(opnd))) & bit)) {
+			return 0;
+		}
+	}
+	for (int s = 0; s < instr->iData->numSrc; s++) {
+		int64_t adjust = iv_address_offset(instr, gpr, offset, s);
+		if (adjust == IV_NONE) return 0;
+		int64_t disp = instr->src[s].longParam + adjust;
+		if (disp < INT32_MIN || disp > INT32_MAX) return 0;
+	}
+	return 1;
+}
+
+// Folds every update of induction variable reg into the last one
+static int iv_fold(instrlist_t* bb, loop_t* loop, int gpr, int reg, int64_t total) {
+	uint64_t bit = 1ULL << gpr;
+	uint8_t removed[LOOP_MAX_BODY + 1];
+	memset(removed, 0, sizeof(removed));
+	int kept = -1;
+	for (int i = 0; i < loop->n; i++) {
+		if (!(loop->eff[i].regsWritten & bit)) continue;
+		if (kept >= 0) removed[kept] = 1;
+		kept = i;
+	}
+	if (kept < 0 || total < INT32_MIN || total > INT32_MAX) return 0;
+	instr_t* keptInstr = loop->nodes[kept];
+	int opcode = instr_get_opcode(keptInstr);
+	if (opcode != OP_add && opcode != OP_sub && opcode != OP_lea) return 0;
+	int numRemoved = 0;
+	for (int i = 0; i < kept; i++) {
+		if (!removed[i]) continue;
+		if (!loop_flags_dead_after(loop, i, loop->eff[i].flagsWritten, removed)) return 0;
+		numRemoved++;
+	}
+	if (numRemoved == 0) return 0;
+	// The kept update now adds the whole step at once; the result is the
+	// same, but the carry, overflow and adjust flags may not be
+	if (opcode != OP_lea && !loop_flags_dead_after(loop, kept, FL_CF | FL_OF | FL_AF, removed)) return 0;
+	// Uses in between see the register short of the removed steps, which
+	// their displacements make up for
+	int64_t offset = 0;
+	for (int i = 0; i < kept; i++) {
+		if (removed[i]) {
+			offset += iv_step(loop->nodes[i], reg);
+		} else if (offset != 0 && (loop->eff[i].regsRead & bit) && !iv_can_offset(loop->nodes[i], gpr, offset)) {
+			return 0;
+		}
+	}
+	offset = 0;
+	for (int i = 0; i < kept; i++) {
+		instr_t* instr = loop->nodes[i];
+		if (removed[i]) {
+			offset += iv_step(instr, reg);
+			instrlist_remove(bb, instr);
+			instr_destroy(instr);
+			continue;
+		}
+		if (offset == 0 || !(loop->eff[i].regsRead & bit)) continue;
+		for (int s = 0; s < instr->iData->numSrc; s++) {
+			int64_t adjust = iv_address_offset(instr, gpr, offset, s);
+			if (adjust == 0) continue;
+			instr_opnd_t opnd = instr->src[s];
+			opnd.longParam += adjust;
+			instr_set_src(instr, s, opnd);
+		}
+	}
+	if (opcode == OP_lea) {
+		instr_opnd_t opnd = keptInstr->src[0];
+		opnd.longParam = total;
+		instr_set_src(keptInstr, 0, opnd);
+	} else {
+		instr_set_opcode(keptInstr, OP_add);
+		instr_set_src(keptInstr, 0, opnd_create_immed_int((int) total));
+	}
+	return 1;
+}
+
+// Turns imul t, iv, c at body position m into add t, c * step
+static int iv_reduce_mul(instrlist_t* bb, loop_t* loop, int m) {
+	instr_t* mul = loop->nodes[m];
+	instr_opnd_t* src = mul->src;
+	if (instr_get_opcode(mul) != OP_imul || mul->iData->numSrc != 2 || mul->iData->numDst != 1) return 0;
+	if (src[0].type != OPND_REG || src[1].type != OPND_IMMED_INT || mul->dst[0].type != OPND_REG) return 0;
+	int t = mul->dst[0].p1;
+	int iv = src[0].p1;
+	if (t >= REG_TABLE_SIZE || iv >= REG_TABLE_SIZE || regTable[t].size != 8 || regTable[iv].size != 8) return 0;
+	uint64_t tBit = reg_mask(t);
+	if (tBit == 0 || tBit == reg_mask(iv)) return 0;
+	int reg;
+	int64_t step;
+	if (!iv_analyze(loop, regTable[iv].gpr, &reg, &step) || reg != iv || step == 0) return 0;
+	// t must be written only here, and not read before it in the body,
+	// since the first iteration now sees the preheader's value there
+	for (int j = 0; j <= loop->n; j++) {
+		if (j != m && (loop->eff[j].regsWritten & tBit)) return 0;
+		if (j < m && (loop->eff[j].regsRead & tBit)) return 0;
+	}
+	// Both the add and the preheader leave different flags behind
+	if (!loop_flags_dead_after(loop, m, FL_ARITH, NULL)) return 0;
+	uint8_t live = FL_ARITH;
+	for (int j = 0; j <= loop->n && live; j++) {
+		if (loop->eff[j].flagsRead & live) return 0;
+		live &= ~loop->eff[j].flagsWritten;
+	}
+	int64_t offset = 0;
+	for (int j = 0; j < m; j++) {
+		if (loop->eff[j].regsWritten & reg_mask(iv)) offset += iv_step(loop->nodes[j], iv);
+	}
+	int64_t c = src[1].p1;
+	if (step < INT32_MIN || step > INT32_MAX || offset - step < INT32_MIN || offset - step > INT32_MAX) return 0;
+	int64_t bodyImm = c * step;
+	int64_t preImm = c * (offset - step);
+	if (bodyImm < INT32_MIN || bodyImm > INT32_MAX || preImm < INT32_MIN || preImm > INT32_MAX) return 0;
+	instr_t* head = loop->nodes[0];
+	instrlist_preinsert(bb, head, instr_clone(mul));
+	if (preImm != 0) {
+		instr_t* adjust = instr_clone(mul);
+		instr_set_opcode(adjust, OP_add);
+		instr_set_src(adjust, 0, opnd_create_immed_int((int) preImm));
+		instr_set_src(adjust, 1, opnd_create_reg(t));
+		instrlist_preinsert(bb, head, adjust);
+	}
+	instr_set_opcode(mul, OP_add);
+	instr_set_src(mul, 0, opnd_create_immed_int((int) bodyImm));
+	instr_set_src(mul, 1, opnd_create_reg(t));
+	instr_get_effects(mul, &loop->eff[m]);
+	loop_set_head(loop, head);
+	return 1;
+}
+
+int iv_reduce_trace(instrlist_t* bb) {
+	loop_t* loop = malloc(sizeof(loop_t));
+	if (!loop_find(bb, loop)) {
+		free(loop);
+		return 0;
+	}
+	int changed = 0;
+	for (int gpr = 0; gpr < 16; gpr++) {
+		int reg;
+		int64_t step;
+		if (iv_analyze(loop, gpr, &reg, &step) && iv_fold(bb, loop, gpr, reg, step)) {
+			changed = 1;
+			loop_find(bb, loop);
+		}
+	}
+	for (int m = 0; m < loop->n; m++) {
+		changed |= iv_reduce_mul(bb, loop, m);
+	}
+	free(loop);
+	return changed;
+}
+
+/* Registers known to hold constants, tracked forward through a trace.
+ * Constants come from mov of an immediate, including into the low 8 or 16
+ * bits of a register already known, and the xor/sub zero idioms; after
+ * cdq/cqo, rdx is also known to hold the sign of rax. Any other write
+ * forgets the register, and barriers and branch targets inside the trace
+ * forget everything.
+ */
+typedef struct {
+	uint32_t known;
+	uint64_t value[16];
+	// Size in bytes of the cdq/cqo rdx currently holds the sign for, or 0
+	int signExtended;
+} const_regs_t;
+
+void const_regs_init(const_regs_t* consts) {
+	consts->known = 0;
+	consts->signExtended = 0;
+}
+
+// Whether reg (a 32- or 64-bit GPR) holds a known value, and if so what
+int const_regs_get(const_regs_t* consts, int reg, uint64_t* value) {
+	if (reg <= 0 || reg >= REG_TABLE_SIZE || regTable[reg].gpr < 0) return 0;
+	int gpr = regTable[reg].gpr;
+	if (!(consts->known & (1u << gpr)) || regTable[reg].size < 4) return 0;
+	*value = regTable[reg].size == 4 ? (uint32_t) consts->value[gpr] : consts->value[gpr];
+	return 1;
+}
+
+void const_regs_step(const_regs_t* consts, instr_t* instr) {
+	instr_effects_t eff;
+	instr_get_effects(instr, &eff);
+	if (eff.barrier) {
+		const_regs_init(consts);
+		return;
+	}
+	int opcode = instr_get_opcode(instr);
+	instr_opnd_t* src = instr->src;
+	int numSrc = instr->iData->numSrc;
+	int reg = instr->iData->numDst == 1 && instr->dst[0].type == OPND_REG ? instr->dst[0].p1 : 0;
+	int size = reg > 0 && reg < REG_TABLE_SIZE && regTable[reg].gpr >= 0 ? regTable[reg].size : 0;
+	int isConst = 0;
+	uint64_t value = 0;
+	if (size >= 4 && (opcode == OP_mov_imm || opcode == OP_mov_st) && numSrc == 1) {
+		if (src[0].type == OPND_IMMED_INT) {
+			isConst = 1;
+			value = (int64_t) src[0].p1;
+		} else if (src[0].type == OPND_IMMED_INT64) {
+			isConst = 1;
+			value = src[0].longParam;
+		}
+	} else if ((size == 1 || size == 2) && regTable[reg].offset == 0 && (opcode == OP_mov_imm || opcode == OP_mov_st) &&
+			numSrc == 1 && src[0].type == OPND_IMMED_INT && (consts->known & (1u << regTable[reg].gpr))) {
+		uint64_t low = size == 1 ? 0xff : 0xffff;
+		isConst = 1;
+		value = (consts->value[regTable[reg].gpr] & ~low) | ((uint64_t) src[0].p1 & low);
+		size = 8;
+	} else if (size >= 4 && (opcode == OP_xor || opcode == OP_sub) && numSrc == 2 &&
+			src[0].type == OPND_REG && src[1].type == OPND_REG && src[0].p1 == reg && src[1].p1 == reg) {
+		isConst = 1;
+	}
+	consts->known &= ~(uint32_t) eff.regsWritten;
+	if (eff.regsWritten & (reg_mask(DR_REG_RAX) | reg_mask(DR_REG_RDX))) consts->signExtended = 0;
+	if (isConst) {
+		int gpr = regTable[reg].gpr;
+		consts->known |= 1u << gpr;
+		consts->value[gpr] = size == 4 ? (uint32_t) value : value;
+	}
+	if (opcode == OP_cdq && instr->iData->numDst == 1 && instr->dst[0].type == OPND_REG) {
+		consts->signExtended = regTable[instr->dst[0].p1].size;
+	}
+}
+
+// Whether the flags instr writes are overwritten before anything reads
+// them. An exit from the trace counts as reading them.
+static int trace_flags_dead_after(instr_t* instr, uint8_t flags) {
+	for (instr_t* next = instr_get_next_app(instr); next != NULL && flags; next = instr_get_next_app(next)) {
+		instr_effects_t eff;
+		instr_get_effects(next, &eff);
+		if (eff.barrier || (eff.flagsRead & flags)) return 0;
+		flags &= ~eff.flagsWritten;
+	}
+	return flags == 0;
+}
+
+// Whether the registers in mask are overwritten after instr before anything
+// reads them; an exit from the trace counts as reading them
+static int trace_regs_dead_after(instr_t* instr, uint64_t mask) {
+	for (instr_t* next = instr_get_next_app(instr); next != NULL && mask; next = instr_get_next_app(next)) {
+		instr_effects_t eff;
+		instr_get_effects(next, &eff);
+		if (eff.barrier || (eff.regsRead & mask)) return 0;
+		mask &= ~eff.regsWritten;
+	}
+	return mask == 0;
+}
+
+/* Strength reduction of multiplies and divides by constants.
+ * 32-bit div and idiv by a register known to hold a constant become a
+ * multiply by its reciprocal scaled by 2^64 and rounded up, M = 2^64 / d
+ * + 1. For dividends below 2^32 the rounding error never reaches the next
+ * integer, so the high half of x * M is the quotient (rounded down; idiv
+ * adds one for negative dividends), and the high half of the low half
+ * times d is the remainder. Powers of two become a shift and a mask.
+ * imul by 2, 3, 4, 5, 8 and 9 becomes an lea, and by other powers of two
+ * a shift, where its flags are dead. The new instructions are built from
+ * scratch and all translate to the instruction they replace.
+ */
+
+// Builds an instruction translating to where's pc and inserts it before where
+static instr_t* strength_insert(instrlist_t* bb, instr_t* where, int opcode, int numDst, int numSrc) {
+	instr_t* instr = instr_build(opcode, numDst, numSrc);
+	instr_set_translation(instr, instr_get_app_pc(where));
+	instrlist_preinsert(bb, where, instr);
+	return instr;
+}
+
+static instr_opnd_t opnd_create_immed_int64(uint64_t value) {
+	instr_opnd_t opnd = {OPND_IMMED_INT64, (int64_t) value, 0, 8};
+	return opnd;
+}
+
+static instr_opnd_t opnd_create_immed_int8(int value) {
+	instr_opnd_t opnd = {OPND_IMMED_INT, 0, value, 1};
+	return opnd;
+}
+
+static void strength_insert_mov(instrlist_t* bb, instr_t* where, int dst, instr_opnd_t src) {
+	int opcode = src.type == OPND_REG ? OP_mov_ld : OP_mov_imm;
+	instr_t* mov = strength_insert(bb, where, opcode, 1, 1);
+	mov->dst[0] = opnd_create_reg(dst);
+	mov->src[0] = src;
+}
+
+// Two-operand arithmetic: dst op= src
+static void strength_insert_alu(instrlist_t* bb, instr_t* where, int opcode, int dst, instr_opnd_t src) {
+	instr_t* alu = strength_insert(bb, where, opcode, 1, 2);
+	alu->dst[0] = opnd_create_reg(dst);
+	alu->src[0] = src;
+	alu->src[1] = opnd_create_reg(dst);
+}
+
+// mul or one-operand imul of rax by src into rdx:rax
+static void strength_insert_mul(instrlist_t* bb, instr_t* where, int opcode, int src) {
+	instr_t* mul = strength_insert(bb, where, opcode, 2, 2);
+	mul->dst[0] = opnd_create_reg(DR_REG_RDX);
+	mul->dst[1] = opnd_create_reg(DR_REG_RAX);
+	mul->src[0] = opnd_create_reg(src);
+	mul->src[1] = opnd_create_reg(DR_REG_RAX);
+}
+
+static int strength_reduce_div(instrlist_t* bb, instr_t* instr, const_regs_t* consts) {
+	int opcode = instr_get_opcode(instr);
+	instr_opnd_t* src = instr->src;
+	if (instr->iData->numSrc != 3 || instr->iData->numDst != 2 || src[0].type != OPND_REG) return 0;
+	int divisor = src[0].p1;
+	uint64_t d;
+	if (!const_regs_get(consts, divisor, &d) || regTable[divisor].size != 4 || d < 2) return 0;
+	int gpr = regTable[divisor].gpr;
+	if (gpr == regTable[DR_REG_RAX].gpr || gpr == regTable[DR_REG_RDX].gpr) return 0;
+	int remainderLive = !trace_regs_dead_after(instr, reg_mask(DR_REG_RDX));
+	int isPow2 = (d & (d - 1)) == 0;
+	uint64_t m = UINT64_MAX / d + 1;
+	if (opcode == OP_div) {
+		uint64_t high;
+		if (!const_regs_get(consts, DR_REG_EDX, &high) || high != 0) return 0;
+		if (isPow2) {
+			strength_insert_mov(bb, instr, DR_REG_EDX, opnd_create_reg(DR_REG_EAX));
+			strength_insert_alu(bb, instr, OP_and, DR_REG_EDX, opnd_create_immed_int((int) (d - 1)));
+			strength_insert_alu(bb, instr, OP_shr, DR_REG_EAX, opnd_create_immed_int8(__builtin_ctzll(d)));
+		} else {
+			strength_insert_mov(bb, instr, DR_REG_EAX, opnd_create_reg(DR_REG_EAX));
+			strength_insert_mov(bb, instr, DR_REG_RDX, opnd_create_immed_int64(m));
+			strength_insert_mul(bb, instr, OP_mul, DR_REG_RDX);
+			if (remainderLive) {
+				// Park the quotient in the divisor's register while the low
+				// half is multiplied back, then put the divisor back
+				int divisor64 = DR_REG_RAX + gpr;
+				strength_insert_mov(bb, instr, divisor, opnd_create_reg(DR_REG_EDX));
+				strength_insert_mov(bb, instr, DR_REG_EDX, opnd_create_immed_int((int) d));
+				strength_insert_mul(bb, instr, OP_mul, DR_REG_RDX);
+				strength_insert_mov(bb, instr, DR_REG_EAX, opnd_create_reg(divisor));
+				strength_insert_mov(bb, instr, divisor64, opnd_create_immed_int64(consts->value[gpr]));
+			} else {
+				strength_insert_mov(bb, instr, DR_REG_EAX, opnd_create_reg(DR_REG_EDX));
+			}
+		}
+	} else if (opcode == OP_idiv) {
+		if (consts->signExtended != 4 || remainderLive || isPow2 || d > INT32_MAX) return 0;
+		instr_t* cdqe = strength_insert(bb, instr, OP_cwde, 1, 1);
+		cdqe->dst[0] = opnd_create_reg(DR_REG_RAX);
+		cdqe->src[0] = opnd_create_reg(DR_REG_EAX);
+		strength_insert_mov(bb, instr, DR_REG_RDX, opnd_create_immed_int64(m));
+		strength_insert_mul(bb, instr, OP_imul, DR_REG_RDX);
+		strength_insert_mov(bb, instr, DR_REG_EAX, opnd_create_reg(DR_REG_EDX));
+		strength_insert_alu(bb, instr, OP_shr, DR_REG_EAX, opnd_create_immed_int8(31));
+		strength_insert_alu(bb, instr, OP_add, DR_REG_EAX, opnd_create_reg(DR_REG_EDX));
+	} else {
+		return 0;
+	}
+	return 1;
+}
+
+static int strength_reduce_imul(instrlist_t* bb, instr_t* instr) {
+	instr_opnd_t* src = instr->src;
+	if (instr->iData->numSrc != 2 || instr->iData->numDst != 1) return 0;
+	if (src[0].type != OPND_REG || src[1].type != OPND_IMMED_INT || instr->dst[0].type != OPND_REG) return 0;
+	int reg = src[0].p1;
+	int dst = instr->dst[0].p1;
+	if (reg >= REG_TABLE_SIZE || dst >= REG_TABLE_SIZE || regTable[reg].gpr < 0 || regTable[reg].size < 4) return 0;
+	int c = src[1].p1;
+	if (c < 2 || !trace_flags_dead_after(instr, FL_ARITH)) return 0;
+	// Addresses are computed in 64 bits; a 32-bit lea keeps the low half
+	int reg64 = DR_REG_RAX + regTable[reg].gpr;
+	if (c == 2 || c == 3 || c == 5 || c == 9 || c == 4 || c == 8) {
+		int base = (c == 4 || c == 8) ? 0 : reg64;
+		int scale = (c == 4 || c == 8) ? c : (c == 2 ? 1 : c - 1);
+		instr_t* lea = strength_insert(bb, instr, OP_lea, 1, 1);
+		lea->dst[0] = opnd_create_reg(dst);
+		lea->src[0].type = OPND_BASE_DISP;
+		lea->src[0].p1 = base | (reg64 << 8) | (scale << 16);
+	} else if ((c & (c - 1)) == 0) {
+		if (dst != reg) strength_insert_mov(bb, instr, dst, opnd_create_reg(reg));
+		strength_insert_alu(bb, instr, OP_shl, dst, opnd_create_immed_int8(__builtin_ctz(c)));
+	} else {
+		return 0;
+	}
+	return 1;
+}
+
+int strength_reduce_trace(instrlist_t* bb) {
+	instr_t* targets[SCHED_MAX_TARGETS];
+	int numTargets = instrlist_get_branch_targets(bb, targets, SCHED_MAX_TARGETS);
+	if (numTargets < 0) return 0;
+	const_regs_t consts;
+	const_regs_init(&consts);
+	int changed = 0;
+	instr_t* instr = instrlist_first_app(bb);
+	while (instr != NULL) {
+		instr_t* next = instr_get_next_app(instr);
+		for (int t = 0; t < numTargets; t++) {
+			if (targets[t] == instr) const_regs_init(&consts);
+		}
+		int opcode = instr_get_opcode(instr);
+		instr_t* first = instr->prev;
+		int reduced = 0;
+		if (opcode == OP_div || opcode == OP_idiv) {
+			reduced = strength_reduce_div(bb, instr, &consts);
+		} else if (opcode == OP_imul) {
+			reduced = strength_reduce_imul(bb, instr);
+		}
+		if (reduced) {
+			// Track constants through the replacement instead
+			first = first == NULL ? instrlist_first_app(bb) : instr_get_next_app(first);
+			for (instr_t* added = first; added != instr; added = instr_get_next_app(added)) {
+				const_regs_step(&consts, added);
+			}
+			// Keep a branch that targets it pointed at the replacement
+			for (instr_t* other = instrlist_first_app(bb); other != NULL; other = instr_get_next_app(other)) {
+				if (instr_get_branch_target_instr(other) == instr) instr_set_branch_target_instr(other, first);
+			}
+			instrlist_remove(bb, instr);
+			instr_destroy(instr);
+			changed = 1;
+		} else {
+			const_regs_step(&consts, instr);
+		}
+		instr = next;
+	}
+	return changed;
+}
+
+/* If-conversion of short forward branches.
+ * DR builds a trace along the path taken when it was recorded, so a branch
+ * over a move or two appears as
+ *     jcc skip ; mov r, x ; (mov r2, y) ; skip: ...
+ * with jcc leaving the trace. When the child's profile says jcc is poorly
+ * predicted, and the expected misprediction cost beats what the
+ * conditional moves add, the moves become cmov on the opposite condition
+ * and the branch goes. Immediates are moved into a dead scratch register
+ * first, and a mov r32, 1 over a register known to hold zero becomes a
+ * setcc of its low byte. cmov of a 32-bit register always zero-extends, so
+ * it is only used where the upper half is known to be zero already.
+ */
+#define IFCONV_MAX_MOVES 2
+// Cycles lost to a mispredicted branch
+#define IFCONV_MISPREDICT_PENALTY 16
+
+// The low byte of GPR gpr, in DR's register order
+static int reg_low_byte(int gpr) {
+	if (gpr < 4) return DR_REG_AL + gpr;
+	if (gpr < 8) return DR_REG_SPL + gpr - 4;
+	return DR_REG_R8L + gpr - 8;
+}
+
+// reg, a GPR, at size bytes; registers of other kinds come back unchanged
+static int reg_resize(int reg, int size) {
+	if (reg <= 0 || reg >= REG_TABLE_SIZE) return reg;
+	int gpr = regTable[reg].gpr;
+	if (gpr < 0 || regTable[reg].offset != 0) return reg;
+	switch (size) {
+	case 8: return DR_REG_RAX + gpr;
+	case 4: return DR_REG_EAX + gpr;
+	case 2: return DR_REG_AX + gpr;
+	case 1: return reg_low_byte(gpr);
+	default: return reg;
+	}
+}
+
+// Whether the register move instr (32- or 64-bit, from a register or an
+// immediate) could be made conditional
+static int ifconv_is_move(instr_t* instr) {
+	int opcode = instr_get_opcode(instr);
+	if ((opcode != OP_mov_ld && opcode != OP_mov_st && opcode != OP_mov_imm) ||
+			instr->iData->numSrc != 1 || instr->iData->numDst != 1) {
+		return 0;
+	}
+	instr_opnd_t* dst = &instr->dst[0];
+	instr_opnd_t* src = &instr->src[0];
+	if (dst->type != OPND_REG || dst->p1 <= 0 || dst->p1 >= REG_TABLE_SIZE || regTable[dst->p1].gpr < 0 ||
+			regTable[dst->p1].size < 4) {
+		return 0;
+	}
+	if (src->type == OPND_REG) {
+		return src->p1 > 0 && src->p1 < REG_TABLE_SIZE && regTable[src->p1].gpr >= 0 &&
+			regTable[src->p1].size == regTable[dst->p1].size;
+	}
+	return src->type == OPND_IMMED_INT || src->type == OPND_IMMED_INT64;
+}
+
+// Whether the upper half of the 32-bit register reg is known to be zero
+// just before instr: the last write to it was a 32-bit one. The branch
+// being converted is looked through.
+static int ifconv_upper_zero(instr_t* instr, instr_t* branch, int reg) {
+	uint64_t mask = reg_mask(reg);
+	for (instr_t* prev = instr->prev; prev != NULL; prev = prev->prev) {
+		if (prev == branch) continue;
+		instr_effects_t eff;
+		instr_get_effects(prev, &eff);
+		if (eff.barrier) return 0;
+		if (!(eff.regsWritten & mask)) continue;
+		for (int d = 0; d < prev->iData->numDst; d++) {
+			instr_opnd_t* dst = &prev->dst[d];
+			if (dst->type == OPND_REG && reg_mask(dst->p1) == mask && regTable[dst->p1].size == 4) return 1;
+		}
+		return 0;
+	}
+	return 0;
+}
+
+// A GPR the moves don't use, dead after last, for loading immediates; or 0
+static int ifconv_find_scratch(instr_t** moves, int numMoves, instr_t* last) {
+	uint64_t used = reg_mask(DR_REG_RSP);
+	for (int m = 0; m < numMoves; m++) {
+		instr_effects_t eff;
+		instr_get_effects(moves[m], &eff);
+		used |= eff.regsRead | eff.regsWritten;
+	}
+	for (int gpr = 0; gpr < 16; gpr++) {
+		int reg = DR_REG_RAX + gpr;
+		if (!(used & reg_mask(reg)) && trace_regs_dead_after(last, reg_mask(reg))) return reg;
+	}
+	return 0;
+}
+
+static instr_t* ifconv_insert(instrlist_t* bb, instr_t* where, unsigned char* pc, int opcode, int dst, instr_opnd_t* src) {
+	instr_t* instr = instr_build(opcode, 1, src != NULL);
+	instr_set_translation(instr, pc);
+	instr->dst[0] = opnd_create_reg(dst);
+	if (src != NULL) instr->src[0] = *src;
+	instrlist_preinsert(bb, where, instr);
+	return instr;
+}
+
+// Converts branch if it qualifies; returns the first instruction that
+// replaced it and its moves, or NULL
+static instr_t* ifconv_branch(instrlist_t* bb, instr_t* branch, const_regs_t* consts, instr_t** targets, int numTargets) {
+	int minority = branch->taken < branch->notTaken ? branch->taken : branch->notTaken;
+	unsigned char* skip = instr_get_branch_target_pc(branch);
+	if (minority == 0 || skip == NULL || instr_get_branch_target_instr(branch) != NULL) return NULL;
+	instr_t* moves[IFCONV_MAX_MOVES];
+	int numMoves = 0;
+	instr_t* join = instr_get_next_app(branch);
+	while (join != NULL && instr_get_app_pc(join) != skip) {
+		if (numMoves == IFCONV_MAX_MOVES || !ifconv_is_move(join)) return NULL;
+		for (int t = 0; t < numTargets; t++) {
+			if (targets[t] == join) return NULL;
+		}
+		moves[numMoves++] = join;
+		join = instr_get_next_app(join);
+	}
+	if (join == NULL || numMoves == 0) return NULL;
+	int cond = opcode_info(instr_get_opcode(branch))->cond;
+	if (cond < 0) return NULL;
+	// The moves ran when the branch fell through
+	int cmov = OP_cmovo + (cond ^ 1);
+	int set = OP_seto + (cond ^ 1);
+	uint64_t known;
+	instr_t* only = moves[0];
+	int useSet = numMoves == 1 && only->src[0].type == OPND_IMMED_INT && only->src[0].p1 == 1 &&
+		const_regs_get(consts, DR_REG_RAX + regTable[only->dst[0].p1].gpr, &known) && known == 0;
+	int scratch = 0;
+	int added = 0;
+	if (useSet) {
+		added = opcode_latency(set);
+	} else {
+		for (int m = 0; m < numMoves; m++) {
+			int reg = moves[m]->dst[0].p1;
+			if (regTable[reg].size == 4 && !ifconv_upper_zero(moves[m], branch, reg)) return NULL;
+			added += opcode_latency(cmov);
+			if (moves[m]->src[0].type != OPND_REG) {
+				if (scratch == 0) scratch = ifconv_find_scratch(moves, numMoves, moves[numMoves - 1]);
+				if (scratch == 0) return NULL;
+				added += opcode_latency(OP_mov_imm);
+			}
+		}
+	}
+	if (minority * IFCONV_MISPREDICT_PENALTY <= added * BRANCH_PROFILE_SCALE) return NULL;
+
+	instr_t* first = NULL;
+	for (int m = 0; m < numMoves; m++) {
+		instr_t* move = moves[m];
+		unsigned char* pc = instr_get_app_pc(move);
+		int reg = move->dst[0].p1;
+		instr_t* replacement;
+		if (useSet) {
+			replacement = ifconv_insert(bb, move, pc, set, reg_low_byte(regTable[reg].gpr), NULL);
+		} else if (move->src[0].type == OPND_REG) {
+			replacement = ifconv_insert(bb, move, pc, cmov, reg, &move->src[0]);
+		} else {
+			int sized = regTable[reg].size == 4 ? DR_REG_EAX + regTable[scratch].gpr : scratch;
+			replacement = ifconv_insert(bb, move, pc, instr_get_opcode(move), sized, &move->src[0]);
+			instr_opnd_t from = opnd_create_reg(sized);
+			ifconv_insert(bb, move, pc, cmov, reg, &from);
+		}
+		if (first == NULL) first = replacement;
+		instrlist_remove(bb, move);
+		instr_destroy(move);
+	}
+	for (instr_t* other = instrlist_first_app(bb); other != NULL; other = instr_get_next_app(other)) {
+		if (instr_get_branch_target_instr(other) == branch) instr_set_branch_target_instr(other, first);
+	}
+	instrlist_remove(bb, branch);
+	instr_destroy(branch);
+	return first;
+}
+
+int ifconv_trace(instrlist_t* bb) {
+	instr_t* targets[SCHED_MAX_TARGETS];
+	int numTargets = instrlist_get_branch_targets(bb, targets, SCHED_MAX_TARGETS);
+	if (numTargets < 0) return 0;
+	const_regs_t consts;
+	const_regs_init(&consts);
+	int changed = 0;
+	instr_t* instr = instrlist_first_app(bb);
+	while (instr != NULL) {
+		instr_t* next = instr_get_next_app(instr);
+		for (int t = 0; t < numTargets; t++) {
+			if (targets[t] == instr) const_regs_init(&consts);
+		}
+		if (!instr_is_cond_branch(instr)) {
+			const_regs_step(&consts, instr);
+			instr = next;
+			continue;
+		}
+		instr_t* first = ifconv_branch(bb, instr, &consts, targets, numTargets);
+		// Branches are barriers, which forget every constant
+		const_regs_init(&consts);
+		if (first != NULL) {
+			changed = 1;
+			numTargets = instrlist_get_branch_targets(bb, targets, SCHED_MAX_TARGETS);
+			if (numTargets < 0) break;
+			// Carry on with the first new instruction
+			next = first;
+		}
+		instr = next;
+	}
+	return changed;
+}
+
+/* Superword-level parallelism within a trace.
+ * Four isomorphic dword chains on adjacent addresses,
+ *     mov r, [a + 4k] ; op r, [b + 4k] (or a register loaded from it) ;
+ *     mov [d + 4k], r
+ * for k = 0..3, as an unrolled array loop leaves them, become one 16-byte
+ * load, packed op and store, where op is add, sub, and, or or xor. The
+ * chains may be interleaved with each other and with unrelated code, and
+ * are packed at the first of their instructions. Nothing in between may
+ * touch their registers or flags, and memory accessed there must provably
+ * miss the three arrays: the same base and index with disjoint
+ * displacements. d must be a or b exactly or provably miss them too.
+ * There are no free vector registers inside someone else's program, so
+ * xmm0 and xmm1 are saved below the red zone around the packed code, and
+ * the cost model only packs when that still saves uops.
+ * The packed code translates to the first scalar instruction, and the app
+ * state there is exactly what it was before that instruction, apart from
+ * rsp and the saved xmm registers. A fault in the packed loads or store is
+ * therefore only precise with the client's restore-state event, which
+ * recognizes the stack adjustment and spills and undoes them.
+ */
+#define SLP_LANES 4
+#define SLP_LANE_SIZE 4
+#define SLP_VECTOR_SIZE (SLP_LANES * SLP_LANE_SIZE)
+// Past the 128-byte red zone, then room to save two xmm registers. Must
+// match SLP_STACK_ADJUST in instrMessage.h
+#define SLP_STACK_ADJUST (128 + 2 * SLP_VECTOR_SIZE)
+
+typedef struct {
+	// Region indices; op and opLoad are -1 if there is no op or it takes
+	// memory directly
+	int store;
+	int op;
+	int load;
+	int opLoad;
+} slp_lane_t;
+
+static int slp_is_lane_mem(instr_opnd_t* opnd) {
+	return opnd->type == OPND_BASE_DISP && opnd_get_segment(opnd) == 0 && opnd_get_mem_size(opnd) == SLP_LANE_SIZE;
+}
+
+static int slp_is_lane_reg(instr_opnd_t* opnd) {
+	return opnd->type == OPND_REG && opnd->p1 > 0 && opnd->p1 < REG_TABLE_SIZE &&
+		regTable[opnd->p1].gpr >= 0 && regTable[opnd->p1].size == SLP_LANE_SIZE;
+}
+
+// Whether b addresses delta bytes past a
+static int slp_address_at(instr_opnd_t* a, instr_opnd_t* b, int64_t delta) {
+	return a->p1 == b->p1 && b->longParam == a->longParam + delta;
+}
+
+// Whether [a, a + sizeA) and [b, b + sizeB) provably don't overlap
+static int slp_disjoint(instr_opnd_t* a, int sizeA, instr_opnd_t* b, int sizeB) {
+	return a->p1 == b->p1 && (a->longParam + sizeA <= b->longParam || b->longParam + sizeB <= a->longParam);
+}
+
+// The last instruction before region index from that writes reg, or -1
+static int slp_find_writer(instr_t** nodes, int from, int reg) {
+	for (int j = from - 1; j >= 0; j--) {
+		instr_effects_t eff;
+		instr_get_effects(nodes[j], &eff);
+		if (eff.regsWritten & reg_mask(reg)) return j;
+	}
+	return -1;
+}
+
+// Whether region index j is "mov reg, [lane mem]"
+static int slp_is_lane_load(instr_t** nodes, int j, int reg) {
+	if (j < 0) return 0;
+	instr_t* instr = nodes[j];
+	return instr_get_opcode(instr) == OP_mov_ld && instr->iData->numSrc == 1 && instr->iData->numDst == 1 &&
+		slp_is_lane_mem(&instr->src[0]) && instr->dst[0].p1 == reg;
+}
+
+// Follows the value a dword store writes back to its loads
+static int slp_find_lane(instr_t** nodes, int s, slp_lane_t* lane) {
+	instr_t* store = nodes[s];
+	if (instr_get_opcode(store) != OP_mov_st || store->iData->numSrc != 1 || store->iData->numDst != 1 ||
+			!slp_is_lane_mem(&store->dst[0]) || !slp_is_lane_reg(&store->src[0])) {
+		return 0;
+	}
+	int reg = store->src[0].p1;
+	lane->store = s;
+	lane->op = -1;
+	lane->opLoad = -1;
+	lane->load = slp_find_writer(nodes, s, reg);
+	if (slp_is_lane_load(nodes, lane->load, reg)) return 1;
+	if (lane->load < 0) return 0;
+	instr_t* op = nodes[lane->load];
+	int opcode = instr_get_opcode(op);
+	if (opcode != OP_add && opcode != OP_sub && opcode != OP_and && opcode != OP_or && opcode != OP_xor) return 0;
+	if (op->iData->numSrc != 2 || op->iData->numDst != 1 || op->dst[0].p1 != reg || !opnd_same(&op->src[1], &op->dst[0])) {
+		return 0;
+	}
+	lane->op = lane->load;
+	lane->load = slp_find_writer(nodes, lane->op, reg);
+	if (!slp_is_lane_load(nodes, lane->load, reg)) return 0;
+	if (slp_is_lane_mem(&op->src[0])) return 1;
+	if (!slp_is_lane_reg(&op->src[0]) || op->src[0].p1 == reg) return 0;
+	lane->opLoad = slp_find_writer(nodes, lane->op, op->src[0].p1);
+	return slp_is_lane_load(nodes, lane->opLoad, op->src[0].p1);
+}
+
+// The memory operand lane k's op reads, directly or through its load
+static instr_opnd_t* slp_op_mem(instr_t** nodes, slp_lane_t* lane) {
+	if (lane->opLoad >= 0) return &nodes[lane->opLoad]->src[0];
+	return &nodes[lane->op]->src[0];
+}
+
+static int slp_uops(instr_t* instr) {
+	int opcode = instr_get_opcode(instr);
+	int uops = opcode_info(opcode)->cost[currentUarch].uops;
+	if (opcode != OP_mov_ld && opcode != OP_mov_st && opcode != OP_lea) {
+		for (int s = 0; s < instr->iData->numSrc; s++) {
+			if (opnd_is_memory_reference(&instr->src[s])) uops += opcode_info(OP_mov_ld)->cost[currentUarch].uops;
+		}
+	}
+	return uops;
+}
+
+static int slp_packed_opcode(int opcode) {
+	switch (opcode) {
+	case OP_add:
+		return OP_paddd;
+	case OP_sub:
+		return OP_psubd;
+	case OP_and:
+		return OP_pand;
+	case OP_or:
+		return OP_por;
+	default:
+		return OP_pxor;
+	}
+}
+
+static instr_t* slp_insert(instrlist_t* bb, instr_t* where, unsigned char* pc, int opcode, instr_opnd_t dst, instr_opnd_t src) {
+	instr_t* instr = instr_build(opcode, 1, opcode == OP_movdqu || opcode == OP_lea || opcode == OP_mov_ld ? 1 : 2);
+	instr_set_translation(instr, pc);
+	instr->dst[0] = dst;
+	instr->src[0] = src;
+	if (instr->iData->numSrc == 2) instr->src[1] = dst;
+	instrlist_preinsert(bb, where, instr);
+	return instr;
+}
+
+// A lane's address widened to the whole vector, and moved past the stack
+// adjustment if it is relative to rsp
+static instr_opnd_t slp_vector_mem(instr_opnd_t* lane) {
+	instr_opnd_t opnd = *lane;
+	opnd.p2 = (opnd.p2 & ~0xFFFF) | SLP_VECTOR_SIZE;
+	if (opnd_get_base(&opnd) == DR_REG_RSP) opnd.longParam += SLP_STACK_ADJUST;
+	return opnd;
+}
+
+static instr_opnd_t slp_stack_mem(int disp, int size) {
+	instr_opnd_t opnd = {OPND_BASE_DISP, disp, DR_REG_RSP, size};
+	return opnd;
+}
+
+// Tries to pack the four chains whose first store is at region index s0
+static int slp_try_group(instrlist_t* bb, instr_t** nodes, int n, int s0) {
+	slp_lane_t lanes[SLP_LANES];
+	if (!slp_find_lane(nodes, s0, &lanes[0])) return 0;
+	instr_opnd_t* d = &nodes[s0]->dst[0];
+	instr_opnd_t* a = &nodes[lanes[0].load]->src[0];
+	instr_opnd_t* b = lanes[0].op >= 0 ? slp_op_mem(nodes, &lanes[0]) : NULL;
+	int opcode = lanes[0].op >= 0 ? instr_get_opcode(nodes[lanes[0].op]) : OP_INVALID;
+	for (int k = 1; k < SLP_LANES; k++) {
+		lanes[k].store = -1;
+		for (int s = 0; s < n && lanes[k].store < 0; s++) {
+			if (instr_get_opcode(nodes[s]) != OP_mov_st || nodes[s]->iData->numDst != 1 ||
+					!slp_address_at(d, &nodes[s]->dst[0], k * SLP_LANE_SIZE)) {
+				continue;
+			}
+			if (!slp_find_lane(nodes, s, &lanes[k])) return 0;
+		}
+		slp_lane_t* lane = &lanes[k];
+		if (lane->store < 0 || (lane->op < 0) != (b == NULL) || (lane->opLoad < 0) != (lanes[0].opLoad < 0)) return 0;
+		if (!slp_address_at(a, &nodes[lane->load]->src[0], k * SLP_LANE_SIZE)) return 0;
+		if (b != NULL && (instr_get_opcode(nodes[lane->op]) != opcode ||
+				!slp_address_at(b, slp_op_mem(nodes, lane), k * SLP_LANE_SIZE))) {
+			return 0;
+		}
+	}
+	// The span the chains cover, their registers and their address registers
+	uint8_t inGroup[SCHED_MAX_REGION];
+	memset(inGroup, 0, n);
+	int lo = n;
+	int hi = -1;
+	uint64_t values = 0;
+	uint64_t addressRegs = 0;
+	int scalarUops = 0;
+	for (int k = 0; k < SLP_LANES; k++) {
+		int members[] = {lanes[k].store, lanes[k].op, lanes[k].load, lanes[k].opLoad};
+		for (int m = 0; m < 4; m++) {
+			int j = members[m];
+			if (j < 0) continue;
+			if (inGroup[j]) return 0;
+			inGroup[j] = 1;
+			lo = j < lo ? j : lo;
+			hi = j > hi ? j : hi;
+			scalarUops += slp_uops(nodes[j]);
+			instr_effects_t eff;
+			instr_get_effects(nodes[j], &eff);
+			values |= eff.regsWritten;
+			for (int s = 0; s < nodes[j]->iData->numSrc; s++) {
+				instr_opnd_t* src = &nodes[j]->src[s];
+				if (src->type == OPND_BASE_DISP) addressRegs |= reg_mask(opnd_get_base(src)) | reg_mask(opnd_get_index(src));
+			}
+		}
+	}
+	addressRegs |= reg_mask(opnd_get_base(d)) | reg_mask(opnd_get_index(d));
+	if (values & addressRegs) return 0;
+	// Within the group, all loads now happen before all stores
+	if (!opnd_same(d, a) && !slp_disjoint(d, SLP_VECTOR_SIZE, a, SLP_VECTOR_SIZE)) return 0;
+	if (b != NULL && !opnd_same(d, b) && !slp_disjoint(d, SLP_VECTOR_SIZE, b, SLP_VECTOR_SIZE)) return 0;
+	for (int j = lo; j <= hi; j++) {
+		if (inGroup[j]) continue;
+		instr_effects_t eff;
+		instr_get_effects(nodes[j], &eff);
+		if (eff.barrier || ((eff.regsRead | eff.regsWritten) & values) || (eff.regsWritten & addressRegs) ||
+				(eff.flagsRead & FL_ARITH)) {
+			return 0;
+		}
+		if (!eff.readsMem && !eff.writesMem) continue;
+		if (opcode_has_prop(instr_get_opcode(nodes[j]), OPI_LOAD | OPI_STORE)) return 0;
+		for (int o = 0; o < nodes[j]->iData->numSrc + nodes[j]->iData->numDst; o++) {
+			int isDst = o >= nodes[j]->iData->numSrc;
+			instr_opnd_t* opnd = isDst ? &nodes[j]->dst[o - nodes[j]->iData->numSrc] : &nodes[j]->src[o];
+			if (opnd->type == OPND_ABS_ADDR) return 0;
+			if (opnd->type != OPND_BASE_DISP) continue;
+			// A read-modify-write destination is read as well
+			int size = opnd_get_mem_size(opnd) > 0 ? opnd_get_mem_size(opnd) : SLP_VECTOR_SIZE;
+			if (!slp_disjoint(opnd, size, d, SLP_VECTOR_SIZE)) return 0;
+			if (isDst && (!slp_disjoint(opnd, size, a, SLP_VECTOR_SIZE) ||
+					(b != NULL && !slp_disjoint(opnd, size, b, SLP_VECTOR_SIZE)))) {
+				return 0;
+			}
+		}
+	}
+	if (opcode != OP_INVALID && !trace_flags_dead_after(nodes[hi], FL_ARITH)) return 0;
+	// Registers still live afterwards are reloaded with their final values
+	int reloadReg[SLP_LANES * 2];
+	instr_opnd_t* reloadFrom[SLP_LANES * 2];
+	int64_t reloadOffset[SLP_LANES * 2];
+	int numReloads = 0;
+	for (int j = hi; j >= lo; j--) {
+		if (!inGroup[j] || instr_get_opcode(nodes[j]) == OP_mov_st) continue;
+		int reg = nodes[j]->dst[0].p1;
+		if (!(values & reg_mask(reg))) continue;
+		values &= ~reg_mask(reg);
+		if (trace_regs_dead_after(nodes[hi], reg_mask(reg))) continue;
+		for (int k = 0; k < SLP_LANES; k++) {
+			if (j == lanes[k].opLoad) {
+				if (opnd_same(b, d)) return 0;
+				reloadFrom[numReloads] = b;
+			} else if (j == lanes[k].op || j == lanes[k].load) {
+				reloadFrom[numReloads] = d;
+			} else {
+				continue;
+			}
+			reloadReg[numReloads] = reg;
+			reloadOffset[numReloads++] = k * SLP_LANE_SIZE;
+		}
+	}
+	// Cost: the packed code plus saving and restoring its xmm registers
+	int vecRegs = b != NULL ? 2 : 1;
+	int movUops = opcode_info(OP_movdqu)->cost[currentUarch].uops;
+	int vectorUops = movUops * (2 + (b != NULL)) + 2 * vecRegs * movUops + 2 * opcode_info(OP_lea)->cost[currentUarch].uops;
+	if (b != NULL) vectorUops += opcode_info(slp_packed_opcode(opcode))->cost[currentUarch].uops;
+	vectorUops += numReloads * opcode_info(OP_mov_ld)->cost[currentUarch].uops;
+	if (vectorUops >= scalarUops) return 0;
+
+	// Everything else in the span commutes with the group, so it goes first
+	instr_t* where = nodes[lo];
+	unsigned char* pc = instr_get_app_pc(nodes[lo]);
+	instr_opnd_t rsp = opnd_create_reg(DR_REG_RSP);
+	instr_t* first = slp_insert(bb, where, pc, OP_lea, rsp, slp_stack_mem(-SLP_STACK_ADJUST, 0));
+	for (int v = 0; v < vecRegs; v++) {
+		slp_insert(bb, where, pc, OP_movdqu, slp_stack_mem(v * SLP_VECTOR_SIZE, SLP_VECTOR_SIZE), opnd_create_reg(DR_REG_XMM0 + v));
+	}
+	slp_insert(bb, where, pc, OP_movdqu, opnd_create_reg(DR_REG_XMM0), slp_vector_mem(a));
+	if (b != NULL) {
+		slp_insert(bb, where, pc, OP_movdqu, opnd_create_reg(DR_REG_XMM1), slp_vector_mem(b));
+		slp_insert(bb, where, pc, slp_packed_opcode(opcode), opnd_create_reg(DR_REG_XMM0), opnd_create_reg(DR_REG_XMM1));
+	}
+	slp_insert(bb, where, pc, OP_movdqu, slp_vector_mem(d), opnd_create_reg(DR_REG_XMM0));
+	for (int v = 0; v < vecRegs; v++) {
+		slp_insert(bb, where, pc, OP_movdqu, opnd_create_reg(DR_REG_XMM0 + v), slp_stack_mem(v * SLP_VECTOR_SIZE, SLP_VECTOR_SIZE));
+	}
+	slp_insert(bb, where, pc, OP_lea, rsp, slp_stack_mem(SLP_STACK_ADJUST, 0));
+	for (int r = 0; r < numReloads; r++) {
+		instr_opnd_t from = *reloadFrom[r];
+		from.longParam += reloadOffset[r];
+		slp_insert(bb, where, pc, OP_mov_ld, opnd_create_reg(reloadReg[r]), from);
+	}
+	// Regions start at branch targets, so only nodes[lo] can be one
+	for (instr_t* other = instrlist_first_app(bb); other != NULL; other = instr_get_next_app(other)) {
+		if (instr_get_branch_target_instr(other) == nodes[lo]) instr_set_branch_target_instr(other, first);
+	}
+	for (int j = lo; j <= hi; j++) {
+		if (!inGroup[j]) continue;
+		instrlist_remove(bb, nodes[j]);
+		instr_destroy(nodes[j]);
+	}
+	return 1;
+}
+
+static int slp_region(instrlist_t* bb, instr_t** nodes, int n) {
+	for (int s = 0; s < n; s++) {
+		if (slp_try_group(bb, nodes, n, s)) return 1;
+	}
+	return 0;
+}
+
+// Packs one group at a time, starting over after each since the regions
+// have changed
+int slp_trace(instrlist_t* bb) {
+	instr_t** nodes = malloc(SCHED_MAX_REGION * sizeof(instr_t*));
+	int changed = 0;
+	int packed = 1;
+	while (packed) {
+		packed = 0;
+		instr_t* targets[SCHED_MAX_TARGETS];
+		int numTargets = instrlist_get_branch_targets(bb, targets, SCHED_MAX_TARGETS);
+		if (numTargets < 0) break;
+		int n = 0;
+		for (instr_t* instr = instrlist_first_app(bb); instr != NULL && !packed; instr = instr_get_next_app(instr)) {
+			for (int t = 0; t < numTargets; t++) {
+				if (targets[t] == instr) {
+					packed = slp_region(bb, nodes, n);
+					n = 0;
+					break;
+				}
+			}
+			if (packed) break;
+			instr_effects_t eff;
+			instr_get_effects(instr, &eff);
+			if (eff.barrier) {
+				packed = slp_region(bb, nodes, n);
+				n = 0;
+			} else {
+				nodes[n++] = instr;
+				if (n == SCHED_MAX_REGION) {
+					packed = slp_region(bb, nodes, n);
+					n = 0;
+				}
+			}
+		}
+		if (!packed) packed = slp_region(bb, nodes, n);
+		changed |= packed;
+	}
+	free(nodes);
+	return changed;
+}
+
+/* Copy propagation.
+ * After mov d, s between two GPRs of the same size (64 bits, or 32 bits,
+ * which zero-extends), later reads of d read s instead, at the same or a
+ * smaller size, until either is written. Only operands whose register can
+ * be chosen freely are rewritten: bases and indexes of memory sources in
+ * instructions without implicit register operands, and register sources
+ * of the moves and two-operand ALU ops below that aren't also written by
+ * the instruction. Destinations are left alone, since replies only carry
+ * source changes. Moves whose destination is then dead are deleted.
+ * Conditional branches keep the copies on the fall-through path; other
+ * barriers and branch targets forget them.
+ */
+static const int copypropOpcodes[] = {
+	OP_mov_ld, OP_mov_st, OP_add, OP_or, OP_adc, OP_sbb, OP_and, OP_sub, OP_xor, OP_cmp, OP_test,
+	OP_lea, OP_movzx, OP_movsx,
+};
+
+typedef struct {
+	// Per GPR: the register it is a copy of (a 64-bit one), and how many
+	// of its low bytes are, or 0 for none
+	int source[16];
+	int size[16];
+} copy_map_t;
+
+static int copyprop_free_opcode(int opcode) {
+	for (int i = 0; i < (int) (sizeof(copypropOpcodes) / sizeof(copypropOpcodes[0])); i++) {
+		if (copypropOpcodes[i] == opcode) return 1;
+	}
+	return 0;
+}
+
+// Whether instr is a move between two distinct GPRs of the same size, 4 or 8
+static int copyprop_is_copy(instr_t* instr) {
+	int opcode = instr_get_opcode(instr);
+	if ((opcode != OP_mov_ld && opcode != OP_mov_st) || instr->iData->numSrc != 1 || instr->iData->numDst != 1) return 0;
+	instr_opnd_t* src = &instr->src[0];
+	instr_opnd_t* dst = &instr->dst[0];
+	if (src->type != OPND_REG || dst->type != OPND_REG) return 0;
+	if (src->p1 <= 0 || src->p1 >= REG_TABLE_SIZE || dst->p1 <= 0 || dst->p1 >= REG_TABLE_SIZE) return 0;
+	if (regTable[src->p1].gpr < 0 || regTable[dst->p1].gpr < 0 || regTable[src->p1].gpr == regTable[dst->p1].gpr) return 0;
+	return regTable[src->p1].size == regTable[dst->p1].size && regTable[src->p1].size >= 4;
+}
+
+// The register to use for a read of reg, or reg itself
+static int copyprop_lookup(copy_map_t* map, int reg, int minSize) {
+	if (reg <= 0 || reg >= REG_TABLE_SIZE || regTable[reg].gpr < 0 || regTable[reg].offset != 0) return reg;
+	int gpr = regTable[reg].gpr;
+	if (map->size[gpr] == 0 || regTable[reg].size > map->size[gpr] || minSize > map->size[gpr]) return reg;
+	return reg_resize(map->source[gpr], regTable[reg].size);
+}
+
+// Rewrites the base and index of a memory operand; returns whether it changed
+static int copyprop_memory(copy_map_t* map, instr_opnd_t* opnd) {
+	if (opnd->type != OPND_BASE_DISP) return 0;
+	int base = opnd_get_base(opnd);
+	int index = opnd_get_index(opnd);
+	// Addresses are 64-bit, so only full copies apply
+	int newBase = base != 0 && regTable[base].size == 8 ? copyprop_lookup(map, base, 8) : base;
+	int newIndex = index != 0 && regTable[index].size == 8 ? copyprop_lookup(map, index, 8) : index;
+	// rsp can't be an index
+	if (newIndex == DR_REG_RSP) newIndex = index;
+	if (newBase == base && newIndex == index) return 0;
+	opnd->p1 = (opnd->p1 & ~0xffff) | newBase | newIndex << 8;
+	return 1;
+}
+
+// Rewrites instr's reads through the copies in map; returns whether it changed
+static int copyprop_rewrite(copy_map_t* map, instr_t* instr) {
+	instr_effects_t eff;
+	instr_get_effects(instr, &eff);
+	const opcode_info_t* info = opcode_info(instr_get_opcode(instr));
+	if (eff.barrier || info->regsRead || info->regsWritten) return 0;
+	int changed = 0;
+	int freeRegs = copyprop_free_opcode(instr_get_opcode(instr));
+	// A REX prefix for spl..dil or r8l..r15l rules out ah..bh
+	int hasHighByte = 0;
+	for (int s = 0; s < instr->iData->numSrc + instr->iData->numDst; s++) {
+		instr_opnd_t* opnd = s < instr->iData->numSrc ? &instr->src[s] : &instr->dst[s - instr->iData->numSrc];
+		hasHighByte |= opnd->type == OPND_REG && opnd->p1 > 0 && opnd->p1 < REG_TABLE_SIZE && regTable[opnd->p1].offset != 0;
+	}
+	for (int s = 0; s < instr->iData->numSrc; s++) {
+		instr_opnd_t opnd = instr->src[s];
+		if (opnd.type == OPND_REG && freeRegs && !(reg_mask(opnd.p1) & eff.regsWritten)) {
+			int reg = copyprop_lookup(map, opnd.p1, 0);
+			if (reg != opnd.p1 && !(hasHighByte && regTable[reg].size == 1)) {
+				instr_set_src(instr, s, opnd_create_reg(reg));
+				changed = 1;
+			}
+		} else if (copyprop_memory(map, &opnd)) {
+			instr_set_src(instr, s, opnd);
+			changed = 1;
+		}
+	}
+	// Destinations can't be rewritten, so a store keeps reading the copy
+	return changed;
+}
+
+// Forgets copies instr invalidates and records the one it makes
+static void copyprop_step(copy_map_t* map, instr_t* instr) {
+	instr_effects_t eff;
+	instr_get_effects(instr, &eff);
+	if (eff.barrier && !instr_is_cond_branch(instr)) {
+		memset(map, 0, sizeof(copy_map_t));
+		return;
+	}
+	for (int gpr = 0; gpr < 16; gpr++) {
+		if (map->size[gpr] != 0 && (eff.regsWritten & ((1ULL << gpr) | reg_mask(map->source[gpr])))) map->size[gpr] = 0;
+	}
+	if (copyprop_is_copy(instr)) {
+		int gpr = regTable[instr->dst[0].p1].gpr;
+		map->source[gpr] = reg_resize(instr->src[0].p1, 8);
+		map->size[gpr] = regTable[instr->dst[0].p1].size;
+	}
+}
+
+int copyprop_trace(instrlist_t* bb) {
+	instr_t* targets[SCHED_MAX_TARGETS];
+	int numTargets = instrlist_get_branch_targets(bb, targets, SCHED_MAX_TARGETS);
+	if (numTargets < 0) return 0;
+	copy_map_t map;
+	memset(&map, 0, sizeof(copy_map_t));
+	int changed = 0;
+	for (instr_t* instr = instrlist_first_app(bb); instr != NULL; instr = instr_get_next_app(instr)) {
+		for (int t = 0; t < numTargets; t++) {
+			if (targets[t] == instr) memset(&map, 0, sizeof(copy_map_t));
+		}
+		changed |= copyprop_rewrite(&map, instr);
+		copyprop_step(&map, instr);
+	}
+	// Delete the moves nothing reads any more
+	instr_t* instr = instrlist_first_app(bb);
+	while (instr != NULL) {
+		instr_t* next = instr_get_next_app(instr);
+		if (copyprop_is_copy(instr) && trace_regs_dead_after(instr, reg_mask(instr->dst[0].p1))) {
+			for (instr_t* other = instrlist_first_app(bb); other != NULL; other = instr_get_next_app(other)) {
+				if (instr_get_branch_target_instr(other) == instr && next != NULL) instr_set_branch_target_instr(other, next);
+			}
+			instrlist_remove(bb, instr);
+			instr_destroy(instr);
+			changed = 1;
+		}
+		instr = next;
+	}
+	return changed;
+}
+
+/* Local value numbering.
+ * Every GPR carries a value number, fresh whenever it is written with
+ * something unknown. A 64-bit register move copies the source's number;
+ * pure computations into a 32- or 64-bit register (lea, ALU ops and shifts
+ * on registers and immediates, movzx/movsx, immediate and 32-bit moves)
+ * are looked up by opcode, size and the numbers of their inputs in a hash
+ * table. If the value is already in some register, the computation is
+ * dropped when that register is the destination, and otherwise becomes a
+ * move from it, as long as the flags it writes are dead. Memory and
+ * barriers aren't numbered, and branch targets and barriers forget
+ * everything, so one pass over the trace suffices.
+ */
+#define LVN_MAX_ITEMS 4
+
+typedef struct {
+	int opcode;
+	int size;
+	int numItems;
+	// Value numbers (tagged with their read size) and immediates
+	int64_t item[LVN_MAX_ITEMS];
+} lvn_key_t;
+
+typedef struct {
+	lvn_key_t key;
+	int vn;
+	int used;
+} lvn_entry_t;
+
+typedef struct {
+	lvn_entry_t* entries;
+	int mask;
+	int vn[16];
+	int nextVn;
+} lvn_t;
+
+static void lvn_forget(lvn_t* lvn) {
+	memset(lvn->entries, 0, (lvn->mask + 1) * sizeof(lvn_entry_t));
+	for (int gpr = 0; gpr < 16; gpr++) lvn->vn[gpr] = lvn->nextVn++;
+}
+
+// The key item for reading reg, or 0 if it isn't a whole GPR of 4 or 8 bytes
+static int64_t lvn_reg_item(lvn_t* lvn, int reg) {
+	if (reg <= 0 || reg >= REG_TABLE_SIZE || regTable[reg].gpr < 0 || regTable[reg].offset != 0) return 0;
+	return (int64_t) regTable[reg].size << 32 | lvn->vn[regTable[reg].gpr];
+}
+
+// Builds the key for what instr computes into its destination register;
+// returns 0 if it isn't something numbered
+static int lvn_make_key(lvn_t* lvn, instr_t* instr, lvn_key_t* key) {
+	static const int pureOpcodes[] = {
+		OP_lea, OP_add, OP_sub, OP_and, OP_or, OP_xor, OP_shl, OP_shr, OP_sar, OP_imul, OP_neg, OP_not,
+		OP_movzx, OP_movsx, OP_mov_ld, OP_mov_st, OP_mov_imm,
+	};
+	int opcode = instr_get_opcode(instr);
+	int pure = 0;
+	for (int i = 0; i < (int) (sizeof(pureOpcodes) / sizeof(pureOpcodes[0])); i++) pure |= pureOpcodes[i] == opcode;
+	const opcode_info_t* info = opcode_info(opcode);
+	if (!pure || info->regsRead || info->regsWritten || instr->iData->numDst != 1 || instr->iData->numSrc > LVN_MAX_ITEMS) {
+		return 0;
+	}
+	int dst = instr->dst[0].type == OPND_REG ? instr->dst[0].p1 : 0;
+	if (dst <= 0 || dst >= REG_TABLE_SIZE || regTable[dst].gpr < 0 || regTable[dst].size < 4) return 0;
+	memset(key, 0, sizeof(lvn_key_t));
+	key->opcode = opcode;
+	key->size = regTable[dst].size;
+	for (int s = 0; s < instr->iData->numSrc; s++) {
+		instr_opnd_t* src = &instr->src[s];
+		int64_t item;
+		if (src->type == OPND_REG) {
+			item = lvn_reg_item(lvn, src->p1);
+			if (item == 0) return 0;
+		} else if (src->type == OPND_IMMED_INT) {
+			item = src->p1;
+			// Immediate moves are the same whichever opcode encodes them
+			if (opcode == OP_mov_st) key->opcode = OP_mov_imm;
+		} else if (src->type == OPND_IMMED_INT64) {
+			item = src->longParam;
+		} else if (src->type == OPND_BASE_DISP && opcode == OP_lea && opnd_get_segment(src) == 0) {
+			// An address is the one operand with four parts
+			int base = opnd_get_base(src);
+			int index = opnd_get_index(src);
+			key->item[0] = base != 0 ? lvn_reg_item(lvn, base) : -1;
+			key->item[1] = index != 0 ? lvn_reg_item(lvn, index) : -1;
+			key->item[2] = opnd_get_scale(src);
+			key->item[3] = src->longParam;
+			key->numItems = LVN_MAX_ITEMS;
+			return key->item[0] != 0 && key->item[1] != 0;
+		} else {
+			return 0;
+		}
+		key->item[key->numItems++] = item;
+	}
+	if ((info->props & OPI_COMMUTATIVE) && key->numItems == 2 && key->item[0] > key->item[1]) {
+		int64_t swap = key->item[0];
+		key->item[0] = key->item[1];
+		key->item[1] = swap;
+	}
+	return 1;
+}
+
+// Finds the entry for key, or the empty slot it would go in
+static lvn_entry_t* lvn_lookup(lvn_t* lvn, lvn_key_t* key) {
+	int slot = (int) (hash_bytes((unsigned char*) key, sizeof(lvn_key_t)) & lvn->mask);
+	while (lvn->entries[slot].used && memcmp(&lvn->entries[slot].key, key, sizeof(lvn_key_t)) != 0) {
+		slot = (slot + 1) & lvn->mask;
+	}
+	return &lvn->entries[slot];
+}
+
+// Numbers instr's result, reusing an earlier copy of it if there is one;
+// returns whether instr was replaced or dropped
+static int lvn_number(instrlist_t* bb, lvn_t* lvn, instr_t* instr) {
+	instr_effects_t eff;
+	instr_get_effects(instr, &eff);
+	lvn_key_t key;
+	int isKey = !eff.barrier && lvn_make_key(lvn, instr, &key);
+	if (!isKey) {
+		for (int gpr = 0; gpr < 16; gpr++) {
+			if (eff.regsWritten & (1ULL << gpr)) lvn->vn[gpr] = lvn->nextVn++;
+		}
+		return 0;
+	}
+	int dst = instr->dst[0].p1;
+	int dstGpr = regTable[dst].gpr;
+	int opcode = instr_get_opcode(instr);
+	// A 64-bit register move just copies the number
+	if ((opcode == OP_mov_ld || opcode == OP_mov_st) && key.size == 8 && instr->src[0].type == OPND_REG) {
+		lvn->vn[dstGpr] = (int) key.item[0];
+		return 0;
+	}
+	lvn_entry_t* entry = lvn_lookup(lvn, &key);
+	if (!entry->used) {
+		entry->key = key;
+		entry->vn = lvn->nextVn++;
+		entry->used = 1;
+		lvn->vn[dstGpr] = entry->vn;
+		return 0;
+	}
+	int holder = -1;
+	for (int gpr = 0; gpr < 16 && holder != dstGpr; gpr++) {
+		if (lvn->vn[gpr] == entry->vn) holder = gpr;
+	}
+	int isImmMove = opcode == OP_mov_imm || ((opcode == OP_mov_st) && instr->src[0].type != OPND_REG);
+	if (holder < 0 || (holder != dstGpr && isImmMove) || (eff.flagsWritten && !trace_flags_dead_after(instr, eff.flagsWritten))) {
+		lvn->vn[dstGpr] = entry->vn;
+		return 0;
+	}
+	lvn->vn[dstGpr] = entry->vn;
+	instr_t* next = instr_get_next_app(instr);
+	instr_t* replacement = NULL;
+	if (holder != dstGpr) {
+		replacement = instr_build(OP_mov_ld, 1, 1);
+		replacement->dst[0] = opnd_create_reg(dst);
+		replacement->src[0] = opnd_create_reg(reg_resize(DR_REG_RAX + holder, key.size));
+		instr_set_translation(replacement, instr_get_app_pc(instr));
+		instrlist_preinsert(bb, instr, replacement);
+	}
+	instr_t* target = replacement != NULL ? replacement : next;
+	for (instr_t* other = instrlist_first_app(bb); other != NULL; other = instr_get_next_app(other)) {
+		if (instr_get_branch_target_instr(other) == instr && target != NULL) instr_set_branch_target_instr(other, target);
+	}
+	instrlist_remove(bb, instr);
+	instr_destroy(instr);
+	return 1;
+}
+
+int lvn_trace(instrlist_t* bb) {
+	instr_t* targets[SCHED_MAX_TARGETS];
+	int numTargets = instrlist_get_branch_targets(bb, targets, SCHED_MAX_TARGETS);
+	if (numTargets < 0) return 0;
+	int num = 0;
+	for (instr_t* instr = instrlist_first_app(bb); instr != NULL; instr = instr_get_next_app(instr)) num++;
+	lvn_t lvn;
+	lvn.mask = 15;
+	while (lvn.mask + 1 < 2 * num) lvn.mask = lvn.mask * 2 + 1;
+	lvn.entries = malloc((lvn.mask + 1) * sizeof(lvn_entry_t));
+	lvn.nextVn = 1;
+	lvn_forget(&lvn);
+	int changed = 0;
+	instr_t* instr = instrlist_first_app(bb);
+	while (instr != NULL) {
+		instr_t* next = instr_get_next_app(instr);
+		for (int t = 0; t < numTargets; t++) {
+			if (targets[t] == instr) lvn_forget(&lvn);
+		}
+		instr_effects_t eff;
+		instr_get_effects(instr, &eff);
+		if (eff.barrier && !instr_is_cond_branch(instr)) {
+			lvn_forget(&lvn);
+		} else {
+			changed |= lvn_number(bb, &lvn, instr);
+		}
+		instr = next;
+	}
+	free(lvn.entries);
+	return changed;
+}
+
+/* Partial register writes.
+ * Writing al or ax merges with the rest of rax: the write depends on the old
+ * value, and a later read of eax or rax waits for a merge. A mov into the
+ * low 8 or 16 bits becomes a full-width write when the result is known:
+ * either the register held a constant, so the merged value can be moved in
+ * whole, or the upper bits were zero and a movzx gives the same value. A
+ * write whose upper bits nothing reads before the register is next written
+ * in full also becomes a movzx (or a 32-bit move of the immediate), which
+ * only breaks the dependency on the old value.
+ */
+enum { PARTIAL_UNKNOWN, PARTIAL_WIDE_READ, PARTIAL_UPPER_DEAD };
+
+// Whether opnd reads more of gpr than its low size bytes
+static int partial_opnd_reads_wide(instr_opnd_t* opnd, int gpr, int size) {
+	if (opnd->type == OPND_REG) {
+		int reg = opnd->p1;
+		if (reg <= 0 || reg >= REG_TABLE_SIZE || regTable[reg].gpr != gpr) return 0;
+		return regTable[reg].size > size || regTable[reg].offset != 0;
+	}
+	if (opnd->type == OPND_BASE_DISP) {
+		return reg_mask(opnd_get_base(opnd)) == 1ULL << gpr || reg_mask(opnd_get_index(opnd)) == 1ULL << gpr;
+	}
+	return 0;
+}
+
+// What happens to gpr's upper bits after instr writes its low size bytes:
+// read before the next full write, or not, as far as the trace shows
+static int partial_classify(instr_t* instr, int gpr, int size) {
+	uint64_t mask = 1ULL << gpr;
+	for (instr_t* next = instr_get_next_app(instr); next != NULL; next = instr_get_next_app(next)) {
+		instr_effects_t eff;
+		instr_get_effects(next, &eff);
+		int opcode = instr_get_opcode(next);
+		// Implicit reads, and cmov which may keep the old value, are wide
+		if (eff.barrier) return PARTIAL_UNKNOWN;
+		if (opcode_info(opcode)->regsRead & mask) return PARTIAL_WIDE_READ;
+		if ((opcode >= OP_cmovo && opcode <= OP_cmovnle) && (eff.regsWritten & mask)) return PARTIAL_WIDE_READ;
+		for (int s = 0; s < next->iData->numSrc; s++) {
+			if (partial_opnd_reads_wide(&next->src[s], gpr, size)) return PARTIAL_WIDE_READ;
+		}
+		int fullWrite = 0;
+		for (int d = 0; d < next->iData->numDst; d++) {
+			instr_opnd_t* dst = &next->dst[d];
+			if (dst->type == OPND_BASE_DISP && partial_opnd_reads_wide(dst, gpr, size)) return PARTIAL_WIDE_READ;
+			// Other partial writes merge and leave the upper bits in place
+			if (dst->type == OPND_REG && (reg_mask(dst->p1) & mask) && regTable[dst->p1].size >= 4) fullWrite = 1;
+		}
+		if (fullWrite) return PARTIAL_UPPER_DEAD;
+	}
+	return PARTIAL_UNKNOWN;
+}
+
+// Replaces instr, a mov into the low size bytes of a GPR, with a full-width
+// write if that's safe; returns the replacement or NULL
+static instr_t* partial_widen(instrlist_t* bb, instr_t* instr, const_regs_t* consts) {
+	int opcode = instr_get_opcode(instr);
+	if ((opcode != OP_mov_ld && opcode != OP_mov_st && opcode != OP_mov_imm) ||
+			instr->iData->numSrc != 1 || instr->iData->numDst != 1 || instr->dst[0].type != OPND_REG) {
+		return NULL;
+	}
+	int reg = instr->dst[0].p1;
+	if (reg <= 0 || reg >= REG_TABLE_SIZE || regTable[reg].gpr < 0 || regTable[reg].offset != 0) return NULL;
+	int gpr = regTable[reg].gpr;
+	int size = regTable[reg].size;
+	if (size >= 4) return NULL;
+	instr_opnd_t* src = &instr->src[0];
+	int isImm = src->type == OPND_IMMED_INT;
+	// movzx from ah..bh can't name r8..r15, so leave those alone
+	if (src->type == OPND_REG && (src->p1 <= 0 || src->p1 >= REG_TABLE_SIZE || regTable[src->p1].offset != 0)) return NULL;
+	if (!isImm && src->type != OPND_REG && src->type != OPND_BASE_DISP) return NULL;
+	uint64_t lowMask = size == 1 ? 0xff : 0xffff;
+	uint64_t old;
+	int known = const_regs_get(consts, DR_REG_RAX + gpr, &old);
+	if (known && !isImm && (old & ~lowMask) != 0) known = 0;
+	if (!known && partial_classify(instr, gpr, size) != PARTIAL_UPPER_DEAD) return NULL;
+	instr_t* wide;
+	if (isImm) {
+		uint64_t value = (known ? old & ~lowMask : 0) | ((uint64_t) src->p1 & lowMask);
+		wide = instr_build(OP_mov_imm, 1, 1);
+		if (value <= 0xffffffffULL) {
+			wide->dst[0] = opnd_create_reg(DR_REG_EAX + gpr);
+			wide->src[0] = opnd_create_immed_int((int) value);
+		} else {
+			wide->dst[0] = opnd_create_reg(DR_REG_RAX + gpr);
+			wide->src[0] = opnd_create_immed_int64(value);
+		}
+	} else {
+		wide = instr_build(OP_movzx, 1, 1);
+		wide->dst[0] = opnd_create_reg(DR_REG_EAX + gpr);
+		wide->src[0] = *src;
+	}
+	instr_set_translation(wide, instr_get_app_pc(instr));
+	instrlist_preinsert(bb, instr, wide);
+	for (instr_t* other = instrlist_first_app(bb); other != NULL; other = instr_get_next_app(other)) {
+		if (instr_get_branch_target_instr(other) == instr) instr_set_branch_target_instr(other, wide);
+	}
+	instrlist_remove(bb, instr);
+	instr_destroy(instr);
+	return wide;
+}
+
+int partial_reg_trace(instrlist_t* bb) {
+	instr_t* targets[SCHED_MAX_TARGETS];
+	int numTargets = instrlist_get_branch_targets(bb, targets, SCHED_MAX_TARGETS);
+	if (numTargets < 0) return 0;
+	const_regs_t consts;
+	const_regs_init(&consts);
+	int changed = 0;
+	for (instr_t* instr = instrlist_first_app(bb); instr != NULL; instr = instr_get_next_app(instr)) {
+		for (int t = 0; t < numTargets; t++) {
+			if (targets[t] == instr) const_regs_init(&consts);
+		}
+		instr_t* wide = partial_widen(bb, instr, &consts);
+		if (wide != NULL) {
+			instr = wide;
+			changed = 1;
+		}
+		const_regs_step(&consts, instr);
+	}
+	return changed;
+}
+
+/* Peephole rules (see peepholeRules.h), compiled into one automaton.
+ * Each rule's opcode sequence goes into an Aho-Corasick automaton over the
+ * opcodes the rules mention, with the failure transitions folded into a
+ * full transition table, so one step per instruction finds every rule
+ * whose opcodes end there. Those are then checked against their operand
+ * patterns and conditions, longest first, and the first that holds is
+ * replaced. Matching starts over after a replacement, and at branch
+ * targets inside the trace.
+ */
+#define PEEP_MAX_INSTRS 4
+#define PEEP_MAX_OPNDS 4
+#define PEEP_MAX_VARS 16
+#define PEEP_MAX_RULES 64
+#define PEEP_MAX_STATES 256
+#define PEEP_MAX_CLASSES 64
+
+enum { PEEP_ANY, PEEP_REG, PEEP_OPND, PEEP_IMM, PEEP_MEM };
+
+typedef struct {
+	int kind;
+	// Variable for registers and operands; for memory, the base's
+	int var;
+	int size;
+	int64_t value;
+	// Memory only: the index's variable (-1 for none), scale and disp
+	int index;
+	int scale;
+} peep_opnd_t;
+
+typedef struct {
+	int opcode;
+	// Replacements only: the matched instruction to keep, or -1
+	int keep;
+	int numDst;
+	int numSrc;
+	peep_opnd_t dst[PEEP_MAX_OPNDS];
+	peep_opnd_t src[PEEP_MAX_OPNDS];
+} peep_instr_t;
+
+typedef struct {
+	const char* text;
+	peep_instr_t match[PEEP_MAX_INSTRS];
+	peep_instr_t replace[PEEP_MAX_INSTRS];
+	int numMatch;
+	int numReplace;
+	uint8_t deadFlags;
+	uint32_t deadVars;
+	// Next rule ending in the same automaton state
+	int16_t nextRule;
+} peep_rule_t;
+
+typedef struct {
+	peep_rule_t rules[PEEP_MAX_RULES];
+	int numRules;
+	// Opcodes the rules use map to classes 1..numClasses-1; the rest to 0
+	uint8_t opcodeClass[OPCODE_TABLE_SIZE];
+	int numClasses;
+	int numStates;
+	int16_t next[PEEP_MAX_STATES][PEEP_MAX_CLASSES];
+	int16_t fail[PEEP_MAX_STATES];
+	int16_t depth[PEEP_MAX_STATES];
+	// First rule ending here, and the nearest shorter state with rules
+	int16_t firstRule[PEEP_MAX_STATES];
+	int16_t outLink[PEEP_MAX_STATES];
+	uint64_t signature;
+} peephole_t;
+
+static peephole_t peephole;
+// The isel pass's rule sets, one per microarchitecture
+static peephole_t iselPeepholes[NUM_UARCH];
+static pthread_once_t peepholeOnce = PTHREAD_ONCE_INIT;
+
+static const struct {
+	const char* name;
+	int opcode;
+} peepOpcodeNames[] = {
+	{"add", OP_add}, {"or", OP_or}, {"adc", OP_adc}, {"sbb", OP_sbb}, {"and", OP_and}, {"sub", OP_sub},
+	{"xor", OP_xor}, {"cmp", OP_cmp}, {"test", OP_test}, {"inc", OP_inc}, {"dec", OP_dec}, {"neg", OP_neg},
+	{"not", OP_not}, {"imul", OP_imul}, {"shl", OP_shl}, {"shr", OP_shr}, {"sar", OP_sar}, {"rol", OP_rol},
+	{"ror", OP_ror}, {"mov_ld", OP_mov_ld}, {"mov_st", OP_mov_st}, {"mov_imm", OP_mov_imm}, {"lea", OP_lea},
+	{"movzx", OP_movzx}, {"movsx", OP_movsx}, {"xchg", OP_xchg}, {"push", OP_push}, {"pop", OP_pop},
+	{"nop_modrm", OP_nop_modrm}, {"bt", OP_bt},
+};
+
+static const struct {
+	const char* name;
+	uint8_t flag;
+} peepFlagNames[] = {
+	{"CF", FL_CF}, {"PF", FL_PF}, {"AF", FL_AF}, {"ZF", FL_ZF}, {"SF", FL_SF}, {"OF", FL_OF}, {"flags", FL_ARITH},
+};
+
+static void peep_skip_space(const char** p) {
+	while (**p == ' ' || **p == '\t') (*p)++;
+}
+
+// Parses a register variable "rN" with an optional ":size"; returns -1 on error
+static int peep_parse_reg_var(const char** p, int* size) {
+	peep_skip_space(p);
+	if (**p != 'r' || (*p)[1] < '0' || (*p)[1] > '7') return -1;
+	int var = (*p)[1] - '0';
+	*p += 2;
+	*size = 0;
+	if (**p == ':') {
+		*size = (int) strtol(*p + 1, (char**) p, 10);
+	}
+	return var;
+}
+
+static int peep_parse_opnd(const char** p, peep_opnd_t* opnd) {
+	memset(opnd, 0, sizeof(peep_opnd_t));
+	opnd->var = -1;
+	opnd->index = -1;
+	peep_skip_space(p);
+	char c = **p;
+	if (c == '_') {
+		opnd->kind = PEEP_ANY;
+		(*p)++;
+	} else if (c == 'r') {
+		opnd->kind = PEEP_REG;
+		opnd->var = peep_parse_reg_var(p, &opnd->size);
+		if (opnd->var < 0) return 0;
+	} else if (c == 'o' && (*p)[1] >= '0' && (*p)[1] <= '7') {
+		opnd->kind = PEEP_OPND;
+		opnd->var = PEEP_MAX_VARS / 2 + (*p)[1] - '0';
+		*p += 2;
+	} else if (c == '$') {
+		char* end;
+		opnd->kind = PEEP_IMM;
+		opnd->value = strtoll(*p + 1, &end, 0);
+		if (end == *p + 1) return 0;
+		*p = end;
+		opnd->size = 4;
+		if (**p == ':') opnd->size = (int) strtol(*p + 1, (char**) p, 10);
+	} else if (c == '[') {
+		// [rA+rB*S+D], each part optional
+		opnd->kind = PEEP_MEM;
+		(*p)++;
+		for (;;) {
+			peep_skip_space(p);
+			if (**p == ']') break;
+			if (**p == '+') (*p)++;
+			peep_skip_space(p);
+			int size;
+			if (**p == 'r') {
+				int var = peep_parse_reg_var(p, &size);
+				if (var < 0) return 0;
+				if (**p == '*') {
+					opnd->index = var;
+					opnd->scale = (int) strtol(*p + 1, (char**) p, 10);
+				} else if (opnd->var < 0) {
+					opnd->var = var;
+				} else {
+					opnd->index = var;
+					opnd->scale = 1;
+				}
+			} else {
+				char* end;
+				opnd->value = strtoll(*p, &end, 0);
+				if (end == *p) return 0;
+				*p = end;
+			}
+		}
+		(*p)++;
+	} else {
+		return 0;
+	}
+	return 1;
+}
+
+// Parses "opcode dsts <- srcs" or "=N" up to ';' or the end of the text
+static int peep_parse_instr(const char* p, const char* end, peep_instr_t* instr) {
+	memset(instr, 0, sizeof(peep_instr_t));
+	instr->keep = -1;
+	peep_skip_space(&p);
+	if (*p == '=') {
+		instr->keep = (int) strtol(p + 1, NULL, 10);
+		return 1;
+	}
+	const char* nameEnd = p;
+	while (nameEnd < end && *nameEnd != ' ') nameEnd++;
+	instr->opcode = -1;
+	for (int i = 0; i < (int) (sizeof(peepOpcodeNames) / sizeof(peepOpcodeNames[0])); i++) {
+		if (strlen(peepOpcodeNames[i].name) == (size_t) (nameEnd - p) &&
+				strncmp(peepOpcodeNames[i].name, p, nameEnd - p) == 0) {
+			instr->opcode = peepOpcodeNames[i].opcode;
+		}
+	}
+	if (instr->opcode < 0) return 0;
+	p = nameEnd;
+	int isSrc = 0;
+	for (;;) {
+		peep_skip_space(&p);
+		if (p >= end) break;
+		if (p[0] == '<' && p[1] == '-') {
+			isSrc = 1;
+			p += 2;
+			continue;
+		}
+		if (*p == ',') {
+			p++;
+			continue;
+		}
+		int* num = isSrc ? &instr->numSrc : &instr->numDst;
+		if (*num == PEEP_MAX_OPNDS) return 0;
+		peep_opnd_t* opnd = isSrc ? &instr->src[*num] : &instr->dst[*num];
+		if (!peep_parse_opnd(&p, opnd) || p > end) return 0;
+		(*num)++;
+	}
+	// An instruction without "<-" only has sources, as in "cmp <- ..."
+	return 1;
+}
+
+// Parses a ';'-separated list of instructions into instrs; returns how many or -1
+static int peep_parse_list(const char* p, const char* end, peep_instr_t* instrs) {
+	int num = 0;
+	while (p < end) {
+		const char* instrEnd = memchr(p, ';', end - p);
+		if (instrEnd == NULL) instrEnd = end;
+		const char* q = p;
+		peep_skip_space(&q);
+		if (q < instrEnd) {
+			if (num == PEEP_MAX_INSTRS || !peep_parse_instr(q, instrEnd, &instrs[num])) return -1;
+			num++;
+		}
+		p = instrEnd + 1;
+	}
+	return num;
+}
+
+static int peep_parse_rule(const char* text, peep_rule_t* rule) {
+	memset(rule, 0, sizeof(peep_rule_t));
+	rule->text = text;
+	const char* arrow = strstr(text, "=>");
+	if (arrow == NULL) return 0;
+	const char* end = text + strlen(text);
+	const char* cond = strstr(arrow, " if ");
+	const char* replaceEnd = cond != NULL ? cond : end;
+	rule->numMatch = peep_parse_list(text, arrow, rule->match);
+	rule->numReplace = peep_parse_list(arrow + 2, replaceEnd, rule->replace);
+	if (rule->numMatch <= 0 || rule->numReplace < 0) return 0;
+	for (int i = 0; i < rule->numMatch; i++) {
+		if (rule->match[i].keep >= 0) return 0;
+	}
+	for (int i = 0; i < rule->numReplace; i++) {
+		if (rule->replace[i].keep >= rule->numMatch) return 0;
+	}
+	// Conditions: dead(...) lists of flags and register variables
+	for (const char* p = cond; p != NULL && (p = strstr(p, "dead(")) != NULL; ) {
+		p += 5;
+		while (*p != ')' && *p != '\0') {
+			peep_skip_space(&p);
+			int found = 0;
+			for (int f = 0; f < (int) (sizeof(peepFlagNames) / sizeof(peepFlagNames[0])); f++) {
+				size_t len = strlen(peepFlagNames[f].name);
+				if (strncmp(p, peepFlagNames[f].name, len) == 0) {
+					rule->deadFlags |= peepFlagNames[f].flag;
+					p += len;
+					found = 1;
+					break;
+				}
+			}
+			if (!found) {
+				int size;
+				int var = peep_parse_reg_var(&p, &size);
+				if (var < 0) return 0;
+				rule->deadVars |= 1u << var;
+			}
+			peep_skip_space(&p);
+			if (*p == ',') p++;
+		}
+	}
+	return 1;
+}
+
+static int peep_class(peephole_t* ph, int opcode) {
+	int c = ph->opcodeClass[opcode & (OPCODE_TABLE_SIZE - 1)];
+	if (c == 0 && ph->numClasses < PEEP_MAX_CLASSES) {
+		c = ph->numClasses++;
+		ph->opcodeClass[opcode & (OPCODE_TABLE_SIZE - 1)] = c;
+	}
+	return c;
+}
+
+static void peephole_compile_rules(peephole_t* ph, const char** rules, int numRules) {
+	memset(ph, 0, sizeof(peephole_t));
+	ph->numClasses = 1;
+	ph->numStates = 1;
+	memset(ph->next, -1, sizeof(ph->next));
+	ph->firstRule[0] = -1;
+	for (int r = 0; r < numRules; r++) {
+		peep_rule_t* rule = &ph->rules[ph->numRules];
+		if (ph->numRules == PEEP_MAX_RULES || !peep_parse_rule(rules[r], rule)) {
+			printf("Skipping peephole rule \"%s\"\n", rules[r]);
+			continue;
+		}
+		// Add its opcodes to the trie
+		int state = 0;
+		int ok = 1;
+		for (int i = 0; i < rule->numMatch && ok; i++) {
+			int c = peep_class(ph, rule->match[i].opcode);
+			if (ph->next[state][c] < 0) {
+				if (ph->numStates == PEEP_MAX_STATES || c == 0) {
+					ok = 0;
+					break;
+				}
+				int added = ph->numStates++;
+				ph->depth[added] = ph->depth[state] + 1;
+				ph->firstRule[added] = -1;
+				ph->next[state][c] = added;
+			}
+			state = ph->next[state][c];
+		}
+		if (!ok) {
+			printf("Skipping peephole rule \"%s\"\n", rules[r]);
+			continue;
+		}
+		// Rules on the same opcodes are tried in the order written
+		rule->nextRule = -1;
+		int16_t* link = &ph->firstRule[state];
+		while (*link >= 0) link = &ph->rules[*link].nextRule;
+		*link = ph->numRules;
+		ph->signature ^= hash_bytes((unsigned char*) rule->text, strlen(rule->text)) * (ph->numRules + 1);
+		ph->numRules++;
+	}
+	// Breadth-first over the trie to set failure links and fill in the
+	// missing transitions from them
+	int16_t queue[PEEP_MAX_STATES];
+	int head = 0;
+	int tail = 0;
+	ph->fail[0] = 0;
+	ph->outLink[0] = -1;
+	for (int c = 0; c < ph->numClasses; c++) {
+		int child = ph->next[0][c];
+		if (child < 0) {
+			ph->next[0][c] = 0;
+		} else {
+			ph->fail[child] = 0;
+			ph->outLink[child] = -1;
+			queue[tail++] = child;
+		}
+	}
+	while (head < tail) {
+		int state = queue[head++];
+		for (int c = 0; c < ph->numClasses; c++) {
+			int child = ph->next[state][c];
+			if (child < 0) {
+				ph->next[state][c] = ph->next[ph->fail[state]][c];
+				continue;
+			}
+			int fail = ph->next[ph->fail[state]][c];
+			ph->fail[child] = fail;
+			ph->outLink[child] = ph->firstRule[fail] >= 0 ? fail : ph->outLink[fail];
+			queue[tail++] = child;
+		}
+	}
+}
+
+static void peephole_compile(void) {
+	peephole_compile_rules(&peephole, peepholeRules, PEEP_RULE_COUNT(peepholeRules));
+	for (int u = 0; u < NUM_UARCH; u++) {
+		peephole_compile_rules(&iselPeepholes[u], iselRuleSets[u].rules, iselRuleSets[u].numRules);
+	}
+}
+
+// Covers the generic rules and the isel rules for the current microarchitecture
+uint64_t peephole_signature(void) {
+	pthread_once(&peepholeOnce, peephole_compile);
+	return peephole.signature ^ iselPeepholes[currentUarch].signature * 31;
+}
+
+typedef struct {
+	instr_opnd_t vars[PEEP_MAX_VARS];
+	uint32_t bound;
+} peep_binding_t;
+
+static int peep_bind(peep_binding_t* binding, int var, instr_opnd_t* opnd) {
+	if (binding->bound & (1u << var)) return opnd_same(&binding->vars[var], opnd);
+	if (var < PEEP_MAX_VARS / 2) {
+		// Different register variables must not overlap
+		for (int other = 0; other < PEEP_MAX_VARS / 2; other++) {
+			if ((binding->bound & (1u << other)) && (reg_mask(binding->vars[other].p1) & reg_mask(opnd->p1))) return 0;
+		}
+	}
+	binding->vars[var] = *opnd;
+	binding->bound |= 1u << var;
+	return 1;
+}
+
+static int peep_bind_reg(peep_binding_t* binding, int var, int reg) {
+	instr_opnd_t opnd = opnd_create_reg(reg);
+	return peep_bind(binding, var, &opnd);
+}
+
+static int peep_match_opnd(peep_opnd_t* pat, instr_opnd_t* opnd, peep_binding_t* binding) {
+	switch (pat->kind) {
+	case PEEP_ANY:
+		return 1;
+	case PEEP_REG:
+		if (opnd->type != OPND_REG || opnd->p1 <= 0 || opnd->p1 >= REG_TABLE_SIZE) return 0;
+		if (pat->size != 0 && regTable[opnd->p1].size != pat->size) return 0;
+		return peep_bind(binding, pat->var, opnd);
+	case PEEP_OPND:
+		return peep_bind(binding, pat->var, opnd);
+	case PEEP_IMM:
+		if (opnd->type == OPND_IMMED_INT) return opnd->p1 == pat->value;
+		return opnd->type == OPND_IMMED_INT64 && opnd->longParam == pat->value;
+	case PEEP_MEM:
+		if (opnd->type != OPND_BASE_DISP || opnd_get_segment(opnd) != 0 || opnd->longParam != pat->value) return 0;
+		if (pat->var < 0 ? opnd_get_base(opnd) != 0 : !peep_bind_reg(binding, pat->var, opnd_get_base(opnd))) return 0;
+		if (pat->index < 0) return opnd_get_index(opnd) == 0;
+		return opnd_get_scale(opnd) == pat->scale && peep_bind_reg(binding, pat->index, opnd_get_index(opnd));
+	default:
+		return 0;
+	}
+}
+
+static int peep_match_instr(peep_instr_t* pat, instr_t* instr, peep_binding_t* binding) {
+	if (instr_get_opcode(instr) != pat->opcode) return 0;
+	if (instr->iData->numSrc != pat->numSrc || instr->iData->numDst != pat->numDst) return 0;
+	for (int s = 0; s < pat->numSrc; s++) {
+		if (!peep_match_opnd(&pat->src[s], &instr->src[s], binding)) return 0;
+	}
+	for (int d = 0; d < pat->numDst; d++) {
+		if (!peep_match_opnd(&pat->dst[d], &instr->dst[d], binding)) return 0;
+	}
+	return 1;
+}
+
+static instr_opnd_t peep_build_opnd(peep_opnd_t* pat, peep_binding_t* binding) {
+	instr_opnd_t opnd = {OPND_NULL, 0, 0, 0};
+	switch (pat->kind) {
+	case PEEP_REG:
+		if (pat->size != 0) return opnd_create_reg(reg_resize(binding->vars[pat->var].p1, pat->size));
+		return binding->vars[pat->var];
+	case PEEP_OPND:
+		return binding->vars[pat->var];
+	case PEEP_IMM:
+		opnd.type = OPND_IMMED_INT;
+		opnd.p1 = (int) pat->value;
+		opnd.p2 = pat->size;
+		return opnd;
+	case PEEP_MEM:
+		opnd.type = OPND_BASE_DISP;
+		opnd.longParam = pat->value;
+		opnd.p1 = (pat->var < 0 ? 0 : binding->vars[pat->var].p1) |
+			(pat->index < 0 ? 0 : binding->vars[pat->index].p1 << 8 | pat->scale << 16);
+		return opnd;
+	default:
+		return opnd;
+	}
+}
+
+// Checks rule against the instructions in matched and replaces them if it
+// holds, setting *resume to the instruction to continue after (NULL for the
+// start of the trace)
+static int peep_try_rule(instrlist_t* bb, peep_rule_t* rule, instr_t** matched, instr_t** resume) {
+	peep_binding_t binding;
+	binding.bound = 0;
+	for (int i = 0; i < rule->numMatch; i++) {
+		if (!peep_match_instr(&rule->match[i], matched[i], &binding)) return 0;
+	}
+	instr_t* last = matched[rule->numMatch - 1];
+	if (rule->deadFlags && !trace_flags_dead_after(last, rule->deadFlags)) return 0;
+	for (int var = 0; var < PEEP_MAX_VARS; var++) {
+		if (!(rule->deadVars & (1u << var))) continue;
+		if (!(binding.bound & (1u << var)) || !trace_regs_dead_after(last, reg_mask(binding.vars[var].p1))) return 0;
+	}
+	instr_t* after = instr_get_next_app(last);
+	// Deleting the end of the trace would leave branches to it pointing nowhere
+	if (rule->numReplace == 0 && after == NULL) {
+		for (instr_t* other = instrlist_first_app(bb); other != NULL; other = instr_get_next_app(other)) {
+			if (instr_get_branch_target_instr(other) == matched[0]) return 0;
+		}
+	}
+	instr_t* replacement[PEEP_MAX_INSTRS];
+	for (int i = 0; i < rule->numReplace; i++) {
+		peep_instr_t* pat = &rule->replace[i];
+		if (pat->keep >= 0) {
+			replacement[i] = matched[pat->keep];
+			continue;
+		}
+		instr_t* instr = instr_build(pat->opcode, pat->numDst, pat->numSrc);
+		instr_t* position = matched[i < rule->numMatch ? i : rule->numMatch - 1];
+		instr_set_translation(instr, instr_get_app_pc(position));
+		for (int s = 0; s < pat->numSrc; s++) instr->src[s] = peep_build_opnd(&pat->src[s], &binding);
+		for (int d = 0; d < pat->numDst; d++) instr->dst[d] = peep_build_opnd(&pat->dst[d], &binding);
+		replacement[i] = instr;
+	}
+	instr_t* head = rule->numReplace > 0 ? replacement[0] : after;
+	for (instr_t* other = instrlist_first_app(bb); other != NULL; other = instr_get_next_app(other)) {
+		if (instr_get_branch_target_instr(other) == matched[0]) instr_set_branch_target_instr(other, head);
+	}
+	for (int i = 0; i < rule->numMatch; i++) {
+		instrlist_remove(bb, matched[i]);
+	}
+	for (int i = 0; i < rule->numReplace; i++) {
+		if (after == NULL) {
+			instrlist_append(bb, replacement[i]);
+		} else {
+			instrlist_preinsert(bb, after, replacement[i]);
+		}
+	}
+	for (int i = 0; i < rule->numMatch; i++) {
+		int kept = 0;
+		for (int k = 0; k < rule->numReplace; k++) kept |= replacement[k] == matched[i];
+		if (!kept) instr_destroy(matched[i]);
+	}
+	if (rule->numReplace > 0) {
+		*resume = replacement[rule->numReplace - 1];
+	} else {
+		*resume = after != NULL ? after->prev : bb->last;
+	}
+	return 1;
+}
+
+static int peephole_run(peephole_t* ph, instrlist_t* bb) {
+	instr_t* targets[SCHED_MAX_TARGETS];
+	int numTargets = instrlist_get_branch_targets(bb, targets, SCHED_MAX_TARGETS);
+	if (numTargets < 0 || ph->numRules == 0) return 0;
+	// The last PEEP_MAX_INSTRS instructions since matching last started over
+	instr_t* window[PEEP_MAX_INSTRS];
+	int windowLen = 0;
+	int state = 0;
+	int changed = 0;
+	instr_t* instr = instrlist_first_app(bb);
+	while (instr != NULL) {
+		for (int t = 0; t < numTargets; t++) {
+			if (targets[t] == instr) {
+				state = 0;
+				windowLen = 0;
+			}
+		}
+		state = ph->next[state][ph->opcodeClass[instr_get_opcode(instr) & (OPCODE_TABLE_SIZE - 1)]];
+		if (windowLen == PEEP_MAX_INSTRS) {
+			memmove(window, window + 1, (PEEP_MAX_INSTRS - 1) * sizeof(instr_t*));
+			windowLen--;
+		}
+		window[windowLen++] = instr;
+		int applied = 0;
+		instr_t* resume = NULL;
+		int found = ph->firstRule[state] >= 0 ? state : ph->outLink[state];
+		for (; found >= 0 && !applied; found = ph->outLink[found]) {
+			if (ph->depth[found] > windowLen) continue;
+			for (int r = ph->firstRule[found]; r >= 0 && !applied; r = ph->rules[r].nextRule) {
+				applied = peep_try_rule(bb, &ph->rules[r], window + windowLen - ph->depth[found], &resume);
+			}
+		}
+		if (applied) {
+			// The match may have been a branch target
+			numTargets = instrlist_get_branch_targets(bb, targets, SCHED_MAX_TARGETS);
+			changed = 1;
+			state = 0;
+			windowLen = 0;
+			instr = resume != NULL ? instr_get_next_app(resume) : instrlist_first_app(bb);
+		} else {
+			instr = instr_get_next_app(instr);
+		}
+	}
+	return changed;
+}
+
+int peephole_trace(instrlist_t* bb) {
+	pthread_once(&peepholeOnce, peephole_compile);
+	return peephole_run(&peephole, bb);
+}
+
+// Instruction selection: the rule set for the CPU the code will run on
+int isel_trace(instrlist_t* bb) {
+	pthread_once(&peepholeOnce, peephole_compile);
+	return peephole_run(&iselPeepholes[currentUarch], bb);
+}
+
+/* Inline caching of indirect branches.
+ * An indirect jmp or call that the child saw go to one target at least
+ * ICACHE_MIN_SHARE of the time first compares its target operand with that
+ * target and, if they match, leaves the trace with a direct branch to it,
+ * which DR links straight to the target's fragment instead of going
+ * through its indirect branch lookup:
+ *     cmp T, target ; jz target ; jmp T
+ *     cmp T, target ; jnz call ; push return ; jz target ; call: call T
+ * The call pushes its return address itself, so jz still sees the flags
+ * from the compare. Both immediates must fit a sign-extended 32 bits, so
+ * position-independent code loaded high is left alone. The compare
+ * clobbers the flags, which compiled code never keeps live across an
+ * indirect branch.
+ */
+#define ICACHE_MIN_SHARE 12
+
+static instr_t* icache_insert(instrlist_t* bb, instr_t* where, int opcode, int numDst, int numSrc) {
+	instr_t* instr = instr_build(opcode, numDst, numSrc);
+	instr_set_translation(instr, instr_get_app_pc(where));
+	instrlist_preinsert(bb, where, instr);
+	return instr;
+}
+
+static instr_opnd_t icache_pc(uint64_t pc) {
+	instr_opnd_t opnd = {OPND_NEAR_PC, (int64_t) pc, 0, 0};
+	return opnd;
+}
+
+// Guards instr with a check for its hot target; returns whether it did
+static int icache_branch(instrlist_t* bb, instr_t* instr) {
+	int branch = opcode_info(instr_get_opcode(instr))->branch;
+	if ((branch != BR_JMP_IND && branch != BR_CALL_IND) || instr->hotTarget == NULL || instr->iData->numSrc < 1) return 0;
+	if (instr->taken * BRANCH_PROFILE_SCALE < ICACHE_MIN_SHARE * (instr->taken + instr->notTaken)) return 0;
+	instr_opnd_t target = instr->src[0];
+	int targetOk = target.type == OPND_REG ? target.p1 > 0 && target.p1 < REG_TABLE_SIZE && regTable[target.p1].size == 8 :
+		target.type == OPND_BASE_DISP && opnd_get_segment(&target) == 0 && opnd_get_mem_size(&target) == 8;
+	uint64_t hot = (uint64_t) instr->hotTarget;
+	uint64_t returnPc = (uint64_t) instr_get_app_pc(instr) + instr->iData->length;
+	if (!targetOk || hot >= 0x80000000ULL || (branch == BR_CALL_IND && returnPc >= 0x80000000ULL)) return 0;
+	instr_t* cmp = icache_insert(bb, instr, OP_cmp, 0, 2);
+	cmp->src[0] = target;
+	cmp->src[1] = opnd_create_immed_int((int) hot);
+	if (branch == BR_CALL_IND) {
+		instr_t* miss = icache_insert(bb, instr, OP_jnz, 0, 1);
+		instr_set_branch_target_instr(miss, instr);
+		instr_t* push = icache_insert(bb, instr, OP_push_imm, 2, 2);
+		push->src[0] = opnd_create_immed_int((int) returnPc);
+		push->src[1] = opnd_create_reg(DR_REG_RSP);
+		push->dst[0] = opnd_create_reg(DR_REG_RSP);
+		push->dst[1] = (instr_opnd_t) {OPND_BASE_DISP, -8, DR_REG_RSP, 8};
+	}
+	instr_t* hit = icache_insert(bb, instr, OP_jz, 0, 1);
+	hit->src[0] = icache_pc(hot);
+	// Branches into the trace that went to instr now go through the check
+	for (instr_t* other = instrlist_first_app(bb); other != NULL; other = instr_get_next_app(other)) {
+		if (other != cmp->next && instr_get_branch_target_instr(other) == instr) instr_set_branch_target_instr(other, cmp);
+	}
+	return 1;
+}
+
+int icache_trace(instrlist_t* bb) {
+	int changed = 0;
+	for (instr_t* instr = instrlist_first_app(bb); instr != NULL; instr = instr_get_next_app(instr)) {
+		changed |= icache_branch(bb, instr);
+	}
+	return changed;
+}
+
+/* Profile-guided branch layout.
+ * A block ends in a conditional branch to T and falls through to F. When
+ * the child saw the branch taken at least LAYOUT_MIN_SHARE of the time,
+ * the condition is inverted and the two swapped, as detectLoop.c does for
+ * back edges:
+ *     jcc T ; (F)   =>   jncc F ; (T)
+ * so the usual path is the fall-through: a not-taken branch, then the
+ * block's exit jump, which DR links straight to T's fragment. Back edges
+ * are left alone; the loop passes want them taken.
+ */
+#define LAYOUT_MIN_SHARE 10
+
+int layout_trace(instrlist_t* bb) {
+	instr_t* last = instrlist_last_app(bb);
+	if (last == NULL || !instr_is_cond_branch(last) || last->iData->length == 0) return 0;
+	if (last->taken == 0 || last->taken * BRANCH_PROFILE_SCALE < LAYOUT_MIN_SHARE * (last->taken + last->notTaken)) return 0;
+	int inverse = opcode_get_inverse(instr_get_opcode(last));
+	unsigned char* target = instr_get_branch_target_pc(last);
+	if (opcode_info(instr_get_opcode(last))->cond < 0 || inverse <= 0 || target == NULL ||
+			target == instr_get_app_pc(instrlist_first_app(bb))) {
+		return 0;
+	}
+	unsigned char* fallThrough = bb->fall_through;
+	if (fallThrough == NULL) fallThrough = instr_get_app_pc(last) + last->iData->length;
+	instr_set_opcode(last, inverse);
+	instr_set_branch_target_pc(last, fallThrough);
+	instrlist_set_fall_through_target(bb, target);
+	int taken = last->taken;
+	last->taken = last->notTaken;
+	last->notTaken = taken;
+	return 1;
+}
+
+/* Software prefetching in loop traces.
+ * A load whose address moves by a constant stride every iteration (its
+ * base and index are induction variables or loop-invariant) gets a
+ * prefetch of the address it will load some iterations ahead, inserted
+ * just before it. The distance covers PREFETCH_MEMORY_LATENCY with the
+ * loop's estimated cycles per iteration: the longer of its dependence
+ * chains and its issue time. Strides under a cache line are left to the
+ * hardware prefetcher, which follows them well; page-sized ones or more
+ * touch each line once, so they are fetched non-temporally. Loads close
+ * enough to share a line share one prefetch.
+ */
+#define PREFETCH_MEMORY_LATENCY 200
+#define PREFETCH_MAX_ITERATIONS 16
+#define PREFETCH_MAX_STREAMS 4
+#define PREFETCH_LINE_SIZE 64
+#define PREFETCH_NTA_STRIDE 4096
+
+// Cycles one iteration of loop takes, at least
+static int prefetch_loop_cycles(loop_t* loop) {
+	int ready[64] = {0};
+	int cycles = (loop->n + SCHED_ISSUE_WIDTH) / SCHED_ISSUE_WIDTH;
+	for (int i = 0; i <= loop->n; i++) {
+		int start = 0;
+		for (int bit = 0; bit < 64; bit++) {
+			if ((loop->eff[i].regsRead >> bit & 1) && ready[bit] > start) start = ready[bit];
+		}
+		int end = start + instr_latency(loop->nodes[i]);
+		for (int bit = 0; bit < 64; bit++) {
+			if (loop->eff[i].regsWritten >> bit & 1) ready[bit] = end;
+		}
+		if (end > cycles) cycles = end;
+	}
+	return cycles;
+}
+
+// How far the address register reg moves per iteration, or IV_NONE if
+// the loop changes it some other way
+static int64_t prefetch_reg_stride(loop_t* loop, int reg) {
+	if (reg == 0) return 0;
+	if (reg >= REG_TABLE_SIZE || regTable[reg].gpr < 0 || regTable[reg].size != 8) return IV_NONE;
+	int gpr = regTable[reg].gpr;
+	int written = 0;
+	for (int i = 0; i < loop->n; i++) written |= (loop->eff[i].regsWritten >> gpr & 1) != 0;
+	if (!written) return 0;
+	int ivReg;
+	int64_t step;
+	if (!iv_analyze(loop, gpr, &ivReg, &step) || ivReg != reg) return IV_NONE;
+	return step;
+}
+
+// The memory source instr loads through, or NULL
+static instr_opnd_t* prefetch_load_opnd(instr_t* instr) {
+	int opcode = instr_get_opcode(instr);
+	if (opcode == OP_lea || opcode == OP_nop_modrm || (opcode >= OP_prefetchnta && opcode <= OP_prefetchw)) return NULL;
+	for (int s = 0; s < instr->iData->numSrc; s++) {
+		instr_opnd_t* opnd = &instr->src[s];
+		if (opnd->type == OPND_BASE_DISP && opnd_get_segment(opnd) == 0) return opnd;
+	}
+	return NULL;
+}
+
+int prefetch_trace(instrlist_t* bb) {
+	loop_t loop;
+	if (!loop_find(bb, &loop)) return 0;
+	int cycles = prefetch_loop_cycles(&loop);
+	int iterations = (PREFETCH_MEMORY_LATENCY + cycles - 1) / cycles;
+	if (iterations > PREFETCH_MAX_ITERATIONS) iterations = PREFETCH_MAX_ITERATIONS;
+	instr_opnd_t streams[PREFETCH_MAX_STREAMS];
+	int numStreams = 0;
+	for (int i = 0; i < loop.n && numStreams < PREFETCH_MAX_STREAMS; i++) {
+		instr_t* load = loop.nodes[i];
+		instr_opnd_t* opnd = prefetch_load_opnd(load);
+		if (opnd == NULL) continue;
+		int64_t baseStride = prefetch_reg_stride(&loop, opnd_get_base(opnd));
+		int64_t indexStride = prefetch_reg_stride(&loop, opnd_get_index(opnd));
+		if (baseStride == IV_NONE || indexStride == IV_NONE) continue;
+		int64_t stride = baseStride + indexStride * opnd_get_scale(opnd);
+		int64_t magnitude = stride < 0 ? -stride : stride;
+		if (magnitude < PREFETCH_LINE_SIZE) continue;
+		int64_t disp = opnd->longParam + stride * iterations;
+		if (disp != (int32_t) disp) continue;
+		int shared = 0;
+		for (int s = 0; s < numStreams; s++) {
+			int64_t apart = streams[s].longParam - opnd->longParam;
+			shared |= streams[s].p1 == opnd->p1 && apart > -PREFETCH_LINE_SIZE && apart < PREFETCH_LINE_SIZE;
+		}
+		if (shared) continue;
+		streams[numStreams++] = *opnd;
+
+		instr_t* prefetch = instr_build(magnitude >= PREFETCH_NTA_STRIDE ? OP_prefetchnta : OP_prefetcht0, 0, 1);
+		instr_set_translation(prefetch, instr_get_app_pc(load));
+		prefetch->src[0] = (instr_opnd_t) {OPND_BASE_DISP, disp, opnd->p1, 1};
+		instrlist_preinsert(bb, load, prefetch);
+		for (instr_t* other = instrlist_first_app(bb); other != NULL; other = instr_get_next_app(other)) {
+			if (instr_get_branch_target_instr(other) == load) instr_set_branch_target_instr(other, prefetch);
+		}
+	}
+	return numStreams > 0;
+}
+
+// Passes run by optimize(), in order. Each returns whether it changed the block.
+typedef struct {
+	const char* name;
+	int (*run)(instrlist_t* bb);
+} optimizer_pass_t;
+
+static const optimizer_pass_t optimizerPasses[] = {
+	{"ifconv", ifconv_trace},
+	{"lvn", lvn_trace},
+	{"copyprop", copyprop_trace},
+	{"licm", licm_trace},
+	{"iv", iv_reduce_trace},
+	{"strength", strength_reduce_trace},
+	{"slp", slp_trace},
+	{"partial", partial_reg_trace},
+	{"peephole", peephole_trace},
+	{"isel", isel_trace},
+	{"icache", icache_trace},
+	{"layout", layout_trace},
+	{"prefetch", prefetch_trace},
+	{"schedule", schedule_trace},
+};
+
+#define NUM_OPTIMIZER_PASSES ((int) (sizeof(optimizerPasses) / sizeof(optimizerPasses[0])))
+
+// Identifies what this optimizer produces, so saved caches from another
+// build or microarchitecture are not reused
+uint64_t optimizer_signature(void) {
+	uint64_t signature = hash_bytes((unsigned char*) &currentUarch, sizeof(currentUarch));
+	for (int p = 0; p < NUM_OPTIMIZER_PASSES; p++) {
+		signature ^= hash_bytes((unsigned char*) optimizerPasses[p].name, strlen(optimizerPasses[p].name)) * (p + 1);
+	}
+	return signature ^ peephole_signature();
+}
+
+// Runs every pass over bb; if passNs is not NULL, the time spent in each
+// pass is added to the matching entry
+void optimize_timed(instrlist_t* bb, uint64_t* passNs) {
+	for (int p = 0; p < NUM_OPTIMIZER_PASSES; p++) {
+		if (passNs == NULL) {
+			optimizerPasses[p].run(bb);
+			continue;
+		}
+		uint64_t start = time_now_ns(CLOCK_MONOTONIC);
+		optimizerPasses[p].run(bb);
+		passNs[p] += time_now_ns(CLOCK_MONOTONIC) - start;
+	}
+}
+
 void optimize(instrlist_t* bb) {
-	// Put optimization stuff here
+	optimize_timed(bb, NULL);
+}
+
+#define REPLAY_MAX_REPORTED_MISMATCHES 10
+
+typedef struct {
+	unsigned char* map;
+	size_t* records;
+	int numRecords;
+	int iterations;
+	int numThreads;
+	int threadId;
+	uint64_t passNs[NUM_OPTIMIZER_PASSES];
+	long blocks;
+	long instrs;
+	long mismatches;
+} replay_worker_t;
+
+// Re-encodes the reply for bb and compares it message by message with the
+// recorded one starting at msg. Returns the index of the first message
+// that differs, or -1 if the diffs are equivalent.
+static int replay_compare_diff(instrlist_t* bb, capture_msg_t* msg, unsigned char* end, unsigned char* buf) {
+	instr_t* toSend = instrlist_first_app(bb);
+	int trailer = 0;
+	for (int index = 0; ; index++) {
+		int len;
+		if (toSend != NULL) {
+			len = encode_instr_reply(toSend, buf);
+			toSend = instr_get_next_app(toSend);
+		} else if (trailer == 0) {
+			len = writeIntToBuf(buf, -1) - buf;
+			trailer = 1;
+		} else if (trailer == 1) {
+			len = writePtrToBuf(buf, bb->fall_through) - buf;
+			trailer = 2;
+		} else {
+			return (unsigned char*) msg == end ? -1 : index;
+		}
+		if ((unsigned char*) msg >= end || msg->length != (uint32_t) len || memcmp(msg + 1, buf, len) != 0) {
+			return index;
+		}
+		msg = capture_msg_next(msg);
+	}
+}
+
+static void* replay_worker(void* arg) {
+	// Counted on this thread's own stack and copied back at the end, so
+	// workers never write to cache lines another one is using
+	replay_worker_t* shared = arg;
+	replay_worker_t local = *shared;
+	replay_worker_t* worker = &local;
+	if (worker->numThreads > 1 && numaTopology.numNodes > 1) {
+		numa_bind(&numaTopology, worker->threadId % numaTopology.numNodes);
+	}
+	unsigned char* buf = malloc(MSG_BUF_SIZE);
+	for (int it = 0; it < worker->iterations; it++) {
+		for (int r = worker->threadId; r < worker->numRecords; r += worker->numThreads) {
+			capture_record_t* record = (capture_record_t*) (worker->map + worker->records[r]);
+			unsigned char* end = (unsigned char*) record + record->length;
+			capture_msg_t* msg = (capture_msg_t*) (record + 1);
+			// Decode in place: the instructions are views over the read-only mapping
+			instrlist_t* bb = instrlist_create();
+			for (int j = 0; j < (int) record->numInstrs; j++) {
+				instr_t* newInst = instr_create_view((instr_data_t*) (msg + 1));
+				newInst->origIndex = j;
+				instrlist_append(bb, newInst);
+				msg = capture_msg_next(msg);
+			}
+			if (record->numProfiles > 0) {
+				instrlist_apply_profiles(bb, (branch_profile_t*) (msg + 1), msg->length / sizeof(branch_profile_t));
+				msg = capture_msg_next(msg);
+			}
+			optimize_timed(bb, worker->passNs);
+			int mismatch = replay_compare_diff(bb, msg, end, buf);
+			if (mismatch != -1) {
+				if (worker->mismatches < REPLAY_MAX_REPORTED_MISMATCHES && it == 0) {
+					printf("record %d (child %u, %u instrs): diff differs from recording at reply message %d\n",
+						r, record->childId, record->numInstrs, mismatch);
+				}
+				worker->mismatches++;
+			}
+			worker->blocks++;
+			worker->instrs += record->numInstrs;
+			instrlist_destroy(bb);
+		}
+	}
+	free(buf);
+	*shared = local;
+	return NULL;
+}
+
+// Streams every block in a capture through optimize() and reports
+// throughput per pass and whether the diffs match the recording.
+// Returns 0 if every diff matched.
+int replay_capture(const char* path, int numThreads, int iterations) {
+	int fd = open(path, O_RDONLY);
+	struct stat st;
+	if (fd == -1 || fstat(fd, &st) == -1 || st.st_size == 0) {
+		printf("Error opening capture file %s\n", path);
+		return 1;
+	}
+	unsigned char* map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (map == MAP_FAILED) {
+		printf("Error mapping capture file %s\n", path);
+		return 1;
+	}
+	size_t end = capture_end(map, st.st_size);
+	if (end == 0) {
+		printf("Error: %s is not a capture file\n", path);
+		munmap(map, st.st_size);
+		return 1;
+	}
+	int numRecords = 0;
+	int maxRecords = 1024;
+	size_t* records = malloc(maxRecords * sizeof(size_t));
+	for (size_t offset = sizeof(capture_header_t); offset < end; offset += ((capture_record_t*) (map + offset))->length) {
+		if (numRecords == maxRecords) {
+			maxRecords *= 2;
+			records = realloc(records, maxRecords * sizeof(size_t));
+		}
+		records[numRecords++] = offset;
+	}
+	replay_worker_t* workers = calloc(numThreads, sizeof(replay_worker_t));
+	pthread_t* threads = malloc(numThreads * sizeof(pthread_t));
+	uint64_t start = time_now_ns(CLOCK_MONOTONIC);
+	for (int t = 0; t < numThreads; t++) {
+		workers[t].map = map;
+		workers[t].records = records;
+		workers[t].numRecords = numRecords;
+		workers[t].iterations = iterations;
+		workers[t].numThreads = numThreads;
+		workers[t].threadId = t;
+		if (numThreads > 1) {
+			pthread_create(&threads[t], NULL, replay_worker, &workers[t]);
+		} else {
+			replay_worker(&workers[t]);
+		}
+	}
+	long blocks = 0;
+	long instrs = 0;
+	long mismatches = 0;
+	uint64_t passNs[NUM_OPTIMIZER_PASSES] = {0};
+	for (int t = 0; t < numThreads; t++) {
+		if (numThreads > 1) pthread_join(threads[t], NULL);
+		blocks += workers[t].blocks;
+		instrs += workers[t].instrs;
+		mismatches += workers[t].mismatches;
+		for (int p = 0; p < NUM_OPTIMIZER_PASSES; p++) {
+			passNs[p] += workers[t].passNs[p];
+		}
+	}
+	double seconds = (time_now_ns(CLOCK_MONOTONIC) - start) / 1e9;
+	printf("replayed %ld blocks (%ld instrs) in %.3f s on %d thread(s): %.0f blocks/s, %.0f instrs/s\n",
+		blocks, instrs, seconds, numThreads, blocks / seconds, instrs / seconds);
+	for (int p = 0; p < NUM_OPTIMIZER_PASSES; p++) {
+		double passSeconds = passNs[p] / 1e9;
+		printf("  %-12s %10.3f ms  %8.1f ns/block  %12.0f instrs/s\n", optimizerPasses[p].name,
+			passNs[p] / 1e6, blocks ? (double) passNs[p] / blocks : 0.0, passSeconds > 0 ? instrs / passSeconds : 0.0);
+	}
+	printf("diff-equivalent: %ld of %ld blocks\n", blocks - mismatches, blocks);
+	free(threads);
+	free(workers);
+	free(records);
+	munmap(map, st.st_size);
+	return mismatches != 0;
 }
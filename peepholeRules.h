@@ -0,0 +1,95 @@
+/* Peephole rules for the parent's peephole pass, which compiles them all
+ * into one automaton over opcodes and applies them in a single scan of
+ * each trace.
+ *
+ * A rule is "pattern => replacement", optionally followed by "if" and a
+ * list of conditions. Patterns and replacements are instructions separated
+ * by ';', each written "opcode dsts <- srcs" with DR's opcode name (without
+ * OP_) and operands in DR's order. Operands are:
+ *   r0..r7         a register; a name used twice is the same register and
+ *                  different names are different ones. ":4" or ":8" after it
+ *                  asks for that size, and in a replacement gives the same
+ *                  register at that size
+ *   o0..o7         any operand, likewise
+ *   $N             an immediate with value N; in a replacement ":1" after it
+ *                  gives its size in bytes (4 otherwise)
+ *   [rA+rB*S+D]    base-disp memory, any part of which may be left out
+ *   _              anything (patterns only)
+ * A replacement "=N" keeps the Nth matched instruction as it is, and an
+ * empty replacement deletes the match. New instructions translate to the
+ * matched instruction in the same position, or the last one. Conditions:
+ *   dead(flags)    none of the arithmetic flags are read after the match
+ *   dead(CF,AF..)  those flags aren't
+ *   dead(r0)       that register isn't
+ * Leaving the trace counts as a read. Rules are tried longest first.
+ */
+
+static const char* peepholeRules[] = {
+	// A 64-bit move to itself does nothing; 32-bit ones zero-extend
+	"mov_ld r0:8 <- r0 =>",
+	"mov_st r0:8 <- r0 =>",
+	// Reloading what was just stored, or moving a value back where it came from
+	"mov_st o0 <- r0:8 ; mov_ld r0 <- o0 => =0",
+	"mov_ld r0:8 <- r1:8 ; mov_ld r1 <- r0 => =0",
+	"mov_ld r0:8 <- r1:8 ; mov_st r1 <- r0 => =0",
+	// Identities that only set flags
+	"add r0:8 <- $0, r0 => if dead(flags)",
+	"sub r0:8 <- $0, r0 => if dead(flags)",
+	"or r0:8 <- $0, r0 => if dead(flags)",
+	"and r0:8 <- $-1, r0 => if dead(flags)",
+	// Zeroing with xor, a zero idiom that breaks dependencies
+	"mov_imm r0:4 <- $0 => xor r0 <- r0, r0 if dead(flags)",
+	"mov_st r0:4 <- $0 => xor r0 <- r0, r0 if dead(flags)",
+	"mov_imm r0:8 <- $0 => xor r0 <- r0, r0 if dead(flags)",
+	"mov_st r0:8 <- $0 => xor r0 <- r0, r0 if dead(flags)",
+	// test is shorter than a compare with zero and differs only in AF
+	"cmp <- r0, $0 => test <- r0, r0 if dead(AF)",
+	// Doubling with add runs on more ports than a shift, and differs only in AF
+	"shl r0 <- $1, r0 => add r0 <- r0, r0 if dead(AF)",
+	// lea of a lone register is a move
+	"lea r0:8 <- [r1] => mov_ld r0 <- r1",
+};
+
+/* Instruction selection rules for the isel pass, one set per
+ * microarchitecture. They run after the rules above, on the same engine,
+ * and pick between equivalent forms whose cost depends on the CPU.
+ */
+static const char* iselRulesModern[] = {
+	// inc and dec are shorter and as fast as adding or subtracting 1, but
+	// leave CF alone and set AF differently for -1
+	"add r0 <- $1, r0 => inc r0 <- r0 if dead(CF)",
+	"sub r0 <- $1, r0 => dec r0 <- r0 if dead(CF)",
+	"add r0 <- $-1, r0 => dec r0 <- r0 if dead(CF, AF)",
+	"sub r0 <- $-1, r0 => inc r0 <- r0 if dead(CF, AF)",
+	// A three-operand add is one lea, which leaves the flags alone
+	"mov_ld r0:8 <- r1:8 ; add r0 <- r2:8, r0 => lea r0 <- [r1+r2] if dead(flags)",
+	// 32-bit zero idioms need no REX prefix and clear the upper half anyway
+	"xor r0:8 <- r0, r0 => xor r0:4 <- r0:4, r0:4",
+	"sub r0:8 <- r0, r0 => xor r0:4 <- r0:4, r0:4 if dead(AF)",
+};
+
+static const char* iselRulesNetburst[] = {
+	// inc and dec only write some of the flags, so the next reader of all of
+	// them waits for the previous writer too; add and sub write them all
+	"inc r0:4 <- r0 => add r0 <- $1:1, r0 if dead(CF)",
+	"inc r0:8 <- r0 => add r0 <- $1:1, r0 if dead(CF)",
+	"dec r0:4 <- r0 => sub r0 <- $1:1, r0 if dead(CF)",
+	"dec r0:8 <- r0 => sub r0 <- $1:1, r0 if dead(CF)",
+	// lea goes through the slow shift unit; adds run on the double-speed ALUs
+	"lea r0:8 <- [r0+r1:8] => add r0 <- r1, r0 if dead(flags)",
+	"lea r0:8 <- [r1:8+r0] => add r0 <- r1, r0 if dead(flags)",
+	"lea r0:8 <- [r1:8+r2:8] => mov_ld r0 <- r1 ; add r0 <- r2, r0 if dead(flags)",
+	"xor r0:8 <- r0, r0 => xor r0:4 <- r0:4, r0:4",
+	"sub r0:8 <- r0, r0 => xor r0:4 <- r0:4, r0:4 if dead(AF)",
+};
+
+#define PEEP_RULE_COUNT(rules) ((int) (sizeof(rules) / sizeof(rules[0])))
+
+static const struct {
+	const char** rules;
+	int numRules;
+} iselRuleSets[NUM_UARCH] = {
+	[UARCH_SKYLAKE] = {iselRulesModern, PEEP_RULE_COUNT(iselRulesModern)},
+	[UARCH_ZEN2] = {iselRulesModern, PEEP_RULE_COUNT(iselRulesModern)},
+	[UARCH_NETBURST] = {iselRulesNetburst, PEEP_RULE_COUNT(iselRulesNetburst)},
+};